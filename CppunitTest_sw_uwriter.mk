@@ -66,6 +66,7 @@ $(eval $(call gb_CppunitTest_use_externals,sw_uwriter,\
 
 $(eval $(call gb_CppunitTest_set_include,sw_uwriter,\
     -I$(SRCDIR)/sw/source/core/inc \
+    -I$(SRCDIR)/sw/source/core/layout \
     -I$(SRCDIR)/sw/inc \
     $$(INCLUDE) \
 ))
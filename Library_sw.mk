@@ -485,6 +485,7 @@ $(eval $(call gb_Library_add_exception_objects,sw,\
     sw/source/core/unocore/unotextmarkup \
     sw/source/core/view/pagepreviewlayout \
     sw/source/core/view/printdata \
+    sw/source/core/view/tilecache \
     sw/source/core/view/vdraw \
     sw/source/core/view/viewimp \
     sw/source/core/view/viewpg \
@@ -34,7 +34,7 @@ class SwField;
 class SwMsgPoolItem;
 class DateTime;
 class _SetGetExpField;
-struct SwHash;
+class SwHashTable;
 class SwNode;
 
 namespace rtl { class OUString; }
@@ -122,7 +122,7 @@ namespace com { namespace sun { namespace star { namespace uno { class Any; } }
 
     virtual void FieldsToCalc(SwCalc& rCalc, const _SetGetExpField& rToThisField) = 0;
 
-    virtual void FieldsToExpand(SwHash**& ppTable, sal_uInt16& rTableSize, const _SetGetExpField& rToThisField) = 0;
+    virtual void FieldsToExpand(SwHashTable& rTable, const _SetGetExpField& rToThisField) = 0;
 
     virtual bool IsNewFieldLst() const = 0;
 
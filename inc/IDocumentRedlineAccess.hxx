@@ -27,10 +27,11 @@
 
 #include <com/sun/star/uno/Sequence.hxx>
 
+#include <docary.hxx>
+
 class SwRangeRedline;
 class SwTableRowRedline;
 class SwTableCellRedline;
-class SwRedlineTable;
 class SwExtraRedlineTable;
 class SwPaM;
 struct SwPosition;
@@ -159,7 +160,7 @@ public:
         /*[in]*/bool bSaveInUndo,
         /*[in]*/sal_uInt16 nDelType) = 0;
 
-    virtual sal_uInt16 GetRedlinePos(
+    virtual SwRedlineTable::size_type GetRedlinePos(
         /*[in]*/const SwNode& rNode,
         /*[in]*/sal_uInt16 nType) const = 0;
 
@@ -167,20 +168,31 @@ public:
 
     virtual const SwRangeRedline* GetRedline(
         /*[in]*/const SwPosition& rPos,
-        /*[in]*/sal_uInt16* pFndPos) const = 0;
+        /*[in]*/SwRedlineTable::size_type* pFndPos) const = 0;
 
     virtual bool IsRedlineMove() const = 0;
 
     virtual void SetRedlineMove(/*[in]*/bool bFlag) = 0;
 
-    virtual bool AcceptRedline(/*[in]*/sal_uInt16 nPos, /*[in]*/bool bCallDelete) = 0;
+    virtual bool AcceptRedline(/*[in]*/SwRedlineTable::size_type nPos, /*[in]*/bool bCallDelete) = 0;
 
     virtual bool AcceptRedline(/*[in]*/const SwPaM& rPam, /*[in]*/bool bCallDelete) = 0;
 
-    virtual bool RejectRedline(/*[in]*/sal_uInt16 nPos, /*[in]*/bool bCallDelete) = 0;
+    virtual bool RejectRedline(/*[in]*/SwRedlineTable::size_type nPos, /*[in]*/bool bCallDelete) = 0;
 
     virtual bool RejectRedline(/*[in]*/const SwPaM& rPam, /*[in]*/bool bCallDelete) = 0;
 
+    /** Accept or reject all redlines of the document, in one pass through
+        the body text and one through each header, footer, footnote or frame
+        with redlines.
+
+        Results in a single undo action; the redline table is compressed and
+        the document set modified only once.
+
+        @returns true if any redline was accepted or rejected
+    */
+    virtual bool AcceptAllRedline(/*[in]*/bool bAcceptReject) = 0;
+
     virtual const SwRangeRedline* SelNextRedline(/*[in]*/SwPaM& rPam) const = 0;
 
     virtual const SwRangeRedline* SelPrevRedline(/*[in]*/SwPaM& rPam) const = 0;
@@ -24,11 +24,14 @@
 #include "sal/types.h"
 #include "swdllapi.h"
 
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 class SfxItemSet;
 class SwAttrPool;
+class SwCharFormat;
 class SwFormatAutoFormat;
 class SwChapterField;
 class SwChapterFieldType;
@@ -65,6 +68,9 @@ public:
      *
      * This method will process the entries in @p entries, starting at @p indexOfEntryToProcess and
      * process @p numberOfEntriesToProcess entries.
+     *
+     * One generator can be used for all entries of a table of X; it remembers the character
+     * formats it looked up.
      */
     void
     GenerateText(SwDoc *doc, const std::vector<SwTOXSortTabBase*>& entries,
@@ -75,6 +81,13 @@ private:
     std::shared_ptr<ToxLinkProcessor> mLinkProcessor;
     std::shared_ptr<ToxTabStopTokenHandler> mTabStopTokenHandler;
 
+    /** The character formats of the tokens, by pool id and name. */
+    std::map<std::pair<sal_uInt16, OUString>, SwCharFormat*> mCharFormats;
+
+    /** Look up the character format of a token, or create it from the pool. */
+    SwCharFormat*
+    GetCharFormatOfToken(const SwFormToken& aToken, SwDoc* pDoc);
+
     /** A handled text token.
      * It contains the information which should be added to the target text node.
      */
@@ -54,12 +54,14 @@ typedef BigPtrEntry* ElementPtr;
 struct BlockInfo {                  // block info:
     BigPtrArray* pBigArr;           ///< in this array the block is located
     ElementPtr* pData;              ///< data block
-    sal_uLong nStart, nEnd;         ///< start- and end index
+    sal_uLong nStart, nEnd;         ///< start- and end index (maybe outdated)
     sal_uInt16 nElem;               ///< number of elements
+    sal_uInt16 nIndex;              ///< position of the block in ppInf
 };
 
 class SW_DLLPUBLIC BigPtrArray
 {
+    friend class BigPtrEntry;
 protected:
     BlockInfo**     ppInf;              // block info
     sal_uLong       nSize;              ///< number of elements
@@ -67,11 +69,17 @@ protected:
     sal_uInt16      nBlock;             ///< number of blocks
     mutable
         sal_uInt16  nCur;               ///< last used block
+    /// first block whose start- and end index may be outdated; the indices
+    /// are recalculated lazily, so that inserting or removing near the start
+    /// of a big array does not touch all following blocks
+    mutable
+        sal_uInt16  nUpdBlock;
 
     sal_uInt16  Index2Block( sal_uLong ) const; ///< block search
     BlockInfo*  InsBlock( sal_uInt16 );         ///< insert block
     void        BlockDel( sal_uInt16 );         ///< some blocks were deleted
-    void        UpdIndex( sal_uInt16 );         ///< recalculate indices
+    void        UpdIndex( sal_uInt16 );         ///< invalidate indices
+    void        ValidateIndex( sal_uInt16 ) const; ///< recalculate indices
 
     // fill all blocks
     // the short parameter specifies in percent, how full the blocks should be
@@ -95,6 +103,8 @@ public:
 inline sal_uLong BigPtrEntry::GetPos() const
 {
     assert(this == pBlock->pData[ nOffset ]); // element not in the block
+    if( pBlock->nIndex >= pBlock->pBigArr->nUpdBlock )
+        pBlock->pBigArr->ValidateIndex( pBlock->nIndex );
     return pBlock->nStart + nOffset;
 }
 
@@ -20,6 +20,7 @@
 #ifndef INCLUDED_SW_INC_CALC_HXX
 #define INCLUDED_SW_INC_CALC_HXX
 
+#include <unordered_map>
 #include <vector>
 #include <basic/sbxvar.hxx>
 #include <unotools/syslocale.hxx>
@@ -31,7 +32,7 @@ class SwFieldType;
 class SwDoc;
 class SwUserFieldType;
 
-#define TBLSZ 47                // should be a prime, because of hash table
+#define TBLSZ 47                // initial size of a hash table, should be a prime
 
 const sal_Unicode cListDelim    = '|';
 
@@ -128,6 +129,7 @@ struct SwHash
     SwHash( const OUString& rStr );
     virtual ~SwHash();
     OUString aStr;
+    sal_uInt32 nHash;       // hash value of aStr, see SwHashTable::HashValue
     SwHash *pNext;
 };
 
@@ -140,10 +142,63 @@ struct SwCalcExp : public SwHash
                 const SwFieldType* pFieldType = 0 );
 };
 
-SwHash* Find( const OUString& rSrch, SwHash* const * ppTable,
-                sal_uInt16 nTableSize, sal_uInt16* pPos = 0 );
+/// Chained hash table of SwHash entries, which it owns.
+///
+/// The number of buckets grows with the number of entries, so the chains
+/// stay short even for documents with thousands of user fields or database
+/// columns.  Entries keep their address when the table grows.
+class SwHashTable
+{
+    std::vector<SwHash*> m_aBuckets;
+    size_t m_nCount;
+
+    void Rehash( size_t nNewSize );
+
+    SwHashTable( const SwHashTable& ) SAL_DELETED_FUNCTION;
+    SwHashTable& operator=( const SwHashTable& ) SAL_DELETED_FUNCTION;
+
+public:
+    explicit SwHashTable( size_t nSize = TBLSZ );
+    ~SwHashTable();
+
+    static sal_uInt32 HashValue( const OUString& rStr )
+        { return static_cast<sal_uInt32>(rStr.hashCode()); }
+
+    SwHash* Find( const OUString& rStr ) const
+        { return Find( rStr, HashValue( rStr ) ); }
+    /// look up with a hash value that the caller has already calculated
+    SwHash* Find( const OUString& rStr, sal_uInt32 nHash ) const;
+
+    /// take over pNew, which must not be in the table yet
+    void Insert( SwHash* pNew );
+    /// remove the entry and return it to the caller, who has to delete it
+    SwHash* Remove( const OUString& rStr );
+    /// delete all entries, but keep the buckets for reuse
+    void Clear();
+
+    size_t Count() const { return m_nCount; }
+};
 
-void DeleteHashTable( SwHash** ppTable, sal_uInt16 nTableSize );
+/// A token of a formula, as GetToken() delivered it
+struct SwCalcToken
+{
+    SwCalcOper  eOper;
+    SwCalcOper  eListOper;
+    SwSbxValue  aNumber;        // value of a CALC_NUMBER
+    OUString    aName;          // variable of a CALC_NAME
+
+    SwCalcToken( SwCalcOper eOp, SwCalcOper eListOp )
+        : eOper( eOp ), eListOper( eListOp ) {}
+};
+
+/// A formula split into tokens; formulas with a syntax error are not split
+struct SwCalcFormula
+{
+    std::vector<SwCalcToken> aTokens;
+    bool bValid;
+
+    SwCalcFormula() : bValid( false ) {}
+};
 
 // if _CalcOp != 0, this is a valid operator
 struct _CalcOp;
@@ -151,7 +206,7 @@ _CalcOp* FindOperator( const OUString& rSearch );
 
 class SwCalc
 {
-    SwHash*     VarTable[ TBLSZ ];
+    SwHashTable VarTable;
     OUString    aVarName, sCurrSym;
     OUString    sCommand;
     std::vector<const SwUserFieldType*> aRekurStk;
@@ -170,6 +225,12 @@ class SwCalc
     SwCalcOper  eCurrListOper;
     SwCalcError eError;
 
+    // Every formula is tokenized once; Calculate() then replays its tokens.
+    std::unordered_map<OUString, SwCalcFormula, OUStringHash> m_aFormulas;
+    const SwCalcFormula* m_pFormula;    // the formula GetToken() replays, or 0
+    size_t      m_nTokenPos;
+
+    const SwCalcFormula* Compile( const OUString& rStr );
     SwCalcOper  GetToken();
     SwSbxValue  Expr();
     SwSbxValue  Term();
@@ -195,7 +256,7 @@ public:
     SwCalcExp*  VarLook( const OUString &rStr, bool bIns = false );
     void        VarChange( const OUString& rStr, const SwSbxValue& rValue );
     void        VarChange( const OUString& rStr, double );
-    SwHash**    GetVarTable()                       { return VarTable; }
+    const SwHashTable& GetVarTable() const          { return VarTable; }
 
     bool        Push(const SwUserFieldType* pUserFieldType);
     void        Pop();
@@ -38,6 +38,7 @@
 #include <viscrs.hxx>
 #include <node.hxx>
 #include <IDocumentMarkAccess.hxx>
+#include <docary.hxx>
 
 class SfxItemSet;
 class SfxPoolItem;
@@ -265,7 +266,7 @@ private:
 typedef bool (SwCursor:: *FNCrsr)();
     SAL_DLLPRIVATE bool CallCrsrFN( FNCrsr );
 
-    SAL_DLLPRIVATE const SwRangeRedline* _GotoRedline( sal_uInt16 nArrPos, bool bSelect );
+    SAL_DLLPRIVATE const SwRangeRedline* _GotoRedline( SwRedlineTable::size_type nArrPos, bool bSelect );
 
 protected:
 
@@ -815,7 +816,7 @@ public:
 
     const SwRangeRedline* SelNextRedline();
     const SwRangeRedline* SelPrevRedline();
-    const SwRangeRedline* GotoRedline( sal_uInt16 nArrPos, bool bSelect = false );
+    const SwRangeRedline* GotoRedline( SwRedlineTable::size_type nArrPos, bool bSelect = false );
 
     // is cursor or the point in/over a vertical formatted text?
     bool IsInVerticalText( const Point* pPt = 0 ) const;
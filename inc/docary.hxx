@@ -194,29 +194,32 @@ public:
 class SwRedlineTable : private _SwRedlineTable
 {
 public:
+    using _SwRedlineTable::size_type;
+    static const size_type npos = static_cast<size_type>(-1);
+
     bool Contains(const SwRangeRedline* p) const { return find(const_cast<SwRangeRedline* const>(p)) != end(); }
-    sal_uInt16 GetPos(const SwRangeRedline* p) const;
+    size_type GetPos(const SwRangeRedline* p) const;
 
     bool Insert( SwRangeRedline* p, bool bIns = true );
-    bool Insert( SwRangeRedline* p, sal_uInt16& rInsPos, bool bIns = true );
-    bool InsertWithValidRanges( SwRangeRedline* p, sal_uInt16* pInsPos = 0 );
+    bool Insert( SwRangeRedline* p, size_type& rInsPos, bool bIns = true );
+    bool InsertWithValidRanges( SwRangeRedline* p, size_type* pInsPos = 0 );
 
-    void Remove( sal_uInt16 nPos );
+    void Remove( size_type nPos );
     bool Remove( const SwRangeRedline* p );
-    void DeleteAndDestroy( sal_uInt16 nPos, sal_uInt16 nLen = 1 );
+    void DeleteAndDestroy( size_type nPos, size_type nLen = 1 );
     void DeleteAndDestroyAll();
 
     void dumpAsXml(struct _xmlTextWriter* pWriter) const;
 
-    sal_uInt16 FindNextOfSeqNo( sal_uInt16 nSttPos ) const;
-    sal_uInt16 FindPrevOfSeqNo( sal_uInt16 nSttPos ) const;
+    size_type FindNextOfSeqNo( size_type nSttPos ) const;
+    size_type FindPrevOfSeqNo( size_type nSttPos ) const;
     /** Search next or previous Redline with the same Seq. No.
        Search can be restricted via Lookahead.
        Using 0 makes search the whole array. */
-    sal_uInt16 FindNextSeqNo( sal_uInt16 nSeqNo, sal_uInt16 nSttPos,
-                            sal_uInt16 nLookahead = 20 ) const;
-    sal_uInt16 FindPrevSeqNo( sal_uInt16 nSeqNo, sal_uInt16 nSttPos,
-                            sal_uInt16 nLookahead = 20 ) const;
+    size_type FindNextSeqNo( sal_uInt16 nSeqNo, size_type nSttPos,
+                            size_type nLookahead = 20 ) const;
+    size_type FindPrevSeqNo( sal_uInt16 nSeqNo, size_type nSttPos,
+                            size_type nLookahead = 20 ) const;
 
     /**
      Find the redline at the given position.
@@ -225,13 +228,22 @@ public:
                        redline (or the next redline after the given position if not found)
      @param next true: redline starts at position and ends after, false: redline starts before position and ends at or after
     */
-    const SwRangeRedline* FindAtPosition( const SwPosition& startPosition, sal_uInt16& tableIndex, bool next = true ) const;
+    const SwRangeRedline* FindAtPosition( const SwPosition& startPosition, size_type& tableIndex, bool next = true ) const;
+
+    /**
+     Find the first redline that ends at or behind the given position.
+
+     Binary search on the starts, then a walk back over the redlines that start in front
+     of the position but still reach it. This relies on redlines in the table not
+     overlapping (AppendRedline splits or joins them), so only the direct predecessors can
+     reach the position.
+    */
+    size_type FindFirstEndingAtOrAfter( const SwPosition& rPos ) const;
 
     using _SwRedlineTable::const_iterator;
     using _SwRedlineTable::begin;
     using _SwRedlineTable::end;
     using _SwRedlineTable::size;
-    using _SwRedlineTable::size_type;
     using _SwRedlineTable::operator[];
     using _SwRedlineTable::empty;
     using _SwRedlineTable::Resort;
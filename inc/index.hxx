@@ -104,6 +104,7 @@ public:
     // Returns pointer to IndexArray (for RTTI at SwIndexReg).
     const SwIndexReg* GetIdxReg() const { return m_pIndexReg; }
     const SwIndex* GetNext() const { return m_pNext; }
+    const SwIndex* GetPrev() const { return m_pPrev; }
 
     const sw::mark::IMark* GetMark() const { return m_pMark; }
     void SetMark(const sw::mark::IMark* pMark);
@@ -69,7 +69,7 @@ class SwXRedlineEnumeration
     , public SwClient
 {
     SwDoc* pDoc;
-    sal_uInt16 nCurrentIndex;
+    size_t nCurrentIndex;
 protected:
     virtual ~SwXRedlineEnumeration();
 public:
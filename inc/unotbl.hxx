@@ -69,7 +69,8 @@ class SwXCell SAL_FINAL : public SwXCellBaseClass,
     friend void   sw_setString( SwXCell &rCell, const OUString &rText,
                                 bool bKeepNumberFormat );
     friend double sw_getValue( SwXCell &rCell );
-    friend void   sw_setValue( SwXCell &rCell, double nVal );
+    friend void   sw_setValue( SwXCell &rCell, double nVal,
+                                bool bUpdateTableFields );
 
     const SfxItemPropertySet*   m_pPropSet;
     SwTableBox*                 pBox;       // only set in non-XML import
@@ -73,6 +73,7 @@
 #include <viewopt.hxx>
 
 #include <deque>
+#include <vector>
 
 class SwDoc;
 class SwDocShell;
@@ -405,6 +406,13 @@ public:
                             int nTilePosY,
                             long nTileWidth,
                             long nTileHeight ) SAL_OVERRIDE;
+    /// Paints several tiles of the same size and zoom at once, see SwViewShell::PaintTiles().
+    void paintTiles( const std::vector<VirtualDevice*>& rDevices,
+                     const std::vector<Point>& rTilePositions,
+                     int nOutputWidth,
+                     int nOutputHeight,
+                     long nTileWidth,
+                     long nTileHeight );
     /// @see vcl::ITiledRenderable::getDocumentSize().
     virtual Size getDocumentSize() SAL_OVERRIDE;
     /// @see vcl::ITiledRenderable::initializeForTiledRendering().
@@ -28,6 +28,7 @@
 #include <swrect.hxx>
 #include <boost/shared_ptr.hpp>
 #include <stack>
+#include <vector>
 #include <vcl/mapmod.hxx>
 #include <vcl/print.hxx>
 #include <vcl/vclptr.hxx>
@@ -255,6 +256,28 @@ public:
     */
     void PaintTile(VirtualDevice &rDevice, int contextWidth, int contextHeight, int tilePosX, int tilePosY, long tileWidth, long tileHeight);
 
+    /** Paint several tiles of the same zoom at once.
+
+        Does the same as calling PaintTile() for each rDevices[i] and
+        rTilePositions[i], but validates the layout only once, and paints
+        the tiles not yet in the tile cache together.
+    */
+    void PaintTiles(const std::vector<VirtualDevice*>& rDevices, const std::vector<Point>& rTilePositions,
+                    int contextWidth, int contextHeight, long tileWidth, long tileHeight);
+
+    /** Maximum number of rectangles the window is invalidated with at the end
+        of an action in tiled rendering mode; if more would be needed, their
+        union is invalidated instead. See InvalidateWindows().
+    */
+    void SetInvalidationBudget(sal_uInt16 nBudget);
+    sal_uInt16 GetInvalidationBudget() const;
+
+    /// Drops the tiles cached by PaintTile() which overlap pRect (logic coordinates), all of them if pRect is 0.
+    void InvalidateTileCache(const Rectangle* pRect);
+    /// Number of PaintTile() calls served from the tile cache, and the ones that had to paint.
+    sal_uInt32 GetTileCacheHits() const;
+    sal_uInt32 GetTileCacheMisses() const;
+
     bool IsPaintInProgress() const { return mbPaintInProgress; }
     bool IsDrawingLayerPaintInProgress() const { return !mPrePostPaintRegions.empty(); }
 
@@ -583,6 +583,64 @@ public:
         releaseBigPtrArrayContent(bparr);
     }
 
+    /** Insert and remove near the front of an array that
+        spans several blocks, so that the block indices
+        behind the edit point are outdated while the
+        positions are queried.
+    */
+    void test_positions_across_blocks()
+    {
+        printMethodName("test_positions_across_blocks\n");
+
+        const sal_uLong nEntries = 5 * MAXENTRY + 17;
+        BigPtrArray bparr;
+
+        fillBigPtrArray(bparr, nEntries);
+
+        for (sal_uLong i = 0; i < 2 * MAXENTRY; i++)
+        {
+            bparr.Insert(new BigPtrEntryMock(nEntries + i), i % 7);
+            if (i % 3 == 0)
+            {
+                CPPUNIT_ASSERT_MESSAGE
+                (
+                    "test_positions_across_blocks failed (last entry)",
+                    static_cast<BigPtrEntryMock*>(bparr[bparr.Count() - 1])->Position() == bparr.Count() - 1
+                );
+            }
+        }
+
+        CPPUNIT_ASSERT_MESSAGE
+        (
+            "test_positions_across_blocks failed (insert)",
+            checkElementPositions(bparr)
+        );
+
+        for (sal_uLong i = 0; i < MAXENTRY + 3; i++)
+        {
+            delete bparr[1];
+            bparr.Remove(1);
+        }
+        sal_uLong nMid = bparr.Count() / 2;
+        for (sal_uLong i = 0; i < MAXENTRY / 2; i++)
+            delete bparr[nMid + i];
+        bparr.Remove(nMid, MAXENTRY / 2);
+
+        CPPUNIT_ASSERT_MESSAGE
+        (
+            "test_positions_across_blocks failed (remove)",
+            checkElementPositions(bparr)
+        );
+
+        CPPUNIT_ASSERT_MESSAGE
+        (
+            "test_positions_across_blocks failed (wrong count)",
+            bparr.Count() == nEntries + 2 * MAXENTRY - (MAXENTRY + 3) - MAXENTRY / 2
+        );
+
+        releaseBigPtrArrayContent(bparr);
+    }
+
     CPPUNIT_TEST_SUITE(BigPtrArrayUnittest);
     CPPUNIT_TEST(test_ctor);
     CPPUNIT_TEST(test_insert_entries_at_front);
@@ -598,6 +656,7 @@ public:
     CPPUNIT_TEST(test_move_elements_from_higher_to_lower_pos);
     CPPUNIT_TEST(test_move_to_same_position);
     CPPUNIT_TEST(test_replace_elements);
+    CPPUNIT_TEST(test_positions_across_blocks);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -659,6 +718,30 @@ public:
     void test_insert_at_front_1000000()
     { test_insert_at_front("1000000"); }
 
+    void test_insert_in_the_middle_1000()
+    { test_insert_in_the_middle("1000"); }
+
+    void test_insert_in_the_middle_10000()
+    { test_insert_in_the_middle("10000"); }
+
+    void test_insert_in_the_middle_100000()
+    { test_insert_in_the_middle("100000"); }
+
+    void test_insert_in_the_middle_1000000()
+    { test_insert_in_the_middle("1000000"); }
+
+    void test_remove_at_front_1000()
+    { test_remove_at_front("1000"); }
+
+    void test_remove_at_front_10000()
+    { test_remove_at_front("10000"); }
+
+    void test_remove_at_front_100000()
+    { test_remove_at_front("100000"); }
+
+    void test_remove_at_front_1000000()
+    { test_remove_at_front("1000000"); }
+
     CPPUNIT_TEST_SUITE(BigPtrArrayPerformanceTest);
     CPPUNIT_TEST(test_insert_at_end_1000);
     CPPUNIT_TEST(test_insert_at_end_10000);
@@ -668,6 +751,14 @@ public:
     CPPUNIT_TEST(test_insert_at_front_10000);
     CPPUNIT_TEST(test_insert_at_front_100000);
     CPPUNIT_TEST(test_insert_at_front_1000000);
+    CPPUNIT_TEST(test_insert_in_the_middle_1000);
+    CPPUNIT_TEST(test_insert_in_the_middle_10000);
+    CPPUNIT_TEST(test_insert_in_the_middle_100000);
+    CPPUNIT_TEST(test_insert_in_the_middle_1000000);
+    CPPUNIT_TEST(test_remove_at_front_1000);
+    CPPUNIT_TEST(test_remove_at_front_10000);
+    CPPUNIT_TEST(test_remove_at_front_100000);
+    CPPUNIT_TEST(test_remove_at_front_1000000);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -696,6 +787,38 @@ private:
 
         releaseBigPtrArrayContent(bparr);
     }
+
+    void test_insert_in_the_middle(const char* numElements)
+    {
+        OStringBuffer buff("test_insert_in_the_middle ");
+        buff.append(numElements);
+        int n = atoi(numElements);
+        PerformanceTracer tracer(buff.getStr());
+        BigPtrArray bparr;
+        for (int i = 0; i < n; i++)
+        {
+            bparr.Insert(new BigPtrEntryMock(i), bparr.Count() / 2);
+            // like SwNodes, query the position of the entry just inserted
+            static_cast<BigPtrEntryMock*>(bparr[bparr.Count() / 2])->Position();
+        }
+
+        releaseBigPtrArrayContent(bparr);
+    }
+
+    void test_remove_at_front(const char* numElements)
+    {
+        OStringBuffer buff("test_remove_at_front ");
+        buff.append(numElements);
+        int n = atoi(numElements);
+        BigPtrArray bparr;
+        fillBigPtrArray(bparr, n);
+        PerformanceTracer tracer(buff.getStr());
+        for (int i = 0; i < n; i++)
+        {
+            delete bparr[0];
+            bparr.Remove(0);
+        }
+    }
 };
 
 #endif
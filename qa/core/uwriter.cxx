@@ -17,6 +17,7 @@
 
 #include <comphelper/processfactory.hxx>
 #include <comphelper/random.hxx>
+#include <tools/stream.hxx>
 #include <tools/urlobj.hxx>
 #include <unotools/tempfile.hxx>
 #include <unotools/transliterationwrapper.hxx>
@@ -36,6 +37,7 @@
 #include <IDocumentRedlineAccess.hxx>
 #include <IDocumentFieldsAccess.hxx>
 #include <IDocumentStatistics.hxx>
+#include "calc.hxx"
 #include "cellfml.hxx"
 #include "docsh.hxx"
 #include "docstat.hxx"
@@ -63,6 +65,8 @@
 #include "ring.hxx"
 #include "calbck.hxx"
 #include "pagedesc.hxx"
+#include "laycache.hxx"
+#include "layhelp.hxx"
 
 typedef tools::SvRef<SwDocShell> SwDocShellRef;
 
@@ -108,9 +112,12 @@ public:
     void testTransliterate();
     void testMarkMove();
     void testFormulas();
+    void testCalcFormulaCache();
     void testIntrusiveRing();
     void testClientModify();
     void test64kPageDescs();
+    void testRedlineTableLookup();
+    void testLayoutCacheChecksum();
 
     CPPUNIT_TEST_SUITE(SwDocTest);
 
@@ -141,9 +148,12 @@ public:
     CPPUNIT_TEST(testGraphicAnchorDeletion);
     CPPUNIT_TEST(testMarkMove);
     CPPUNIT_TEST(testFormulas);
+    CPPUNIT_TEST(testCalcFormulaCache);
     CPPUNIT_TEST(testIntrusiveRing);
     CPPUNIT_TEST(testClientModify);
     CPPUNIT_TEST(test64kPageDescs);
+    CPPUNIT_TEST(testRedlineTableLookup);
+    CPPUNIT_TEST(testLayoutCacheChecksum);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -1214,6 +1224,26 @@ void SwDocTest::testFormulas()
     CPPUNIT_ASSERT_EQUAL(OUString("<?>+<Table1.?>"), aFormula.GetFormula());
 }
 
+void SwDocTest::testCalcFormulaCache()
+{
+    SwCalc aCalc(*m_pDoc);
+
+    // the second evaluation replays the tokens of the first one
+    for (int i = 0; i < 2; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(18.0, aCalc.Calculate("2*3^2").GetDouble());
+        CPPUNIT_ASSERT_EQUAL(7.0, aCalc.Calculate("x=3+4").GetDouble());
+        CPPUNIT_ASSERT_EQUAL(14.0, aCalc.Calculate("x*2").GetDouble());
+        CPPUNIT_ASSERT_EQUAL(2.0, aCalc.Calculate("mean 1|2|3").GetDouble());
+        CPPUNIT_ASSERT_EQUAL(3.0, aCalc.Calculate("max 1|3|2").GetDouble());
+        CPPUNIT_ASSERT(aCalc.Calculate("1 eq 1").GetBool());
+        CPPUNIT_ASSERT(!aCalc.IsCalcError());
+
+        aCalc.Calculate("1 ? 2");
+        CPPUNIT_ASSERT(aCalc.IsCalcError());
+    }
+}
+
 void SwDocTest::testMarkMove()
 {
     IDocumentMarkAccess* pMarksAccess = m_pDoc->getIDocumentMarkAccess();
@@ -1615,6 +1645,161 @@ void SwDocTest::test64kPageDescs()
     CPPUNIT_ASSERT( nPos == 0 );
 }
 
+void SwDocTest::testRedlineTableLookup()
+{
+    const size_t nParaCount = 1000;
+    IDocumentRedlineAccess& rIDRA = m_pDoc->getIDocumentRedlineAccess();
+
+    SwNodeIndex aIdx(m_pDoc->GetNodes().GetEndOfContent(), -1);
+    SwPaM aPaM(aIdx);
+    std::vector<SwTextNode*> aTextNodes;
+    for (size_t i = 0; i < nParaCount; ++i)
+    {
+        m_pDoc->getIDocumentContentOperations().AppendTextNode(*aPaM.GetPoint());
+        m_pDoc->getIDocumentContentOperations().InsertString(aPaM, "Lorem ipsum");
+        aTextNodes.push_back(aPaM.GetNode().GetTextNode());
+    }
+    // a trailing paragraph without any change
+    m_pDoc->getIDocumentContentOperations().AppendTextNode(*aPaM.GetPoint());
+    const SwNode& rUnchanged = aPaM.GetNode();
+
+    rIDRA.SetRedlineMode(nsRedlineMode_t::REDLINE_ON | nsRedlineMode_t::REDLINE_SHOW_DELETE|nsRedlineMode_t::REDLINE_SHOW_INSERT);
+    // delete "Lorem" in every paragraph, one redline each
+    for (size_t i = 0; i < nParaCount; ++i)
+    {
+        SwPaM aDel(*aTextNodes[i], 0, *aTextNodes[i], 5);
+        m_pDoc->getIDocumentContentOperations().DeleteAndJoin(aDel);
+    }
+
+    const SwRedlineTable& rTable = rIDRA.GetRedlineTable();
+    CPPUNIT_ASSERT_EQUAL(nParaCount, rTable.size());
+
+    for (size_t i = 0; i < nParaCount; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(i, rIDRA.GetRedlinePos(*aTextNodes[i], USHRT_MAX));
+
+        SwRedlineTable::size_type nPos = 0;
+        SwPosition aInside(*aTextNodes[i], 2);
+        CPPUNIT_ASSERT(rTable.FindAtPosition(aInside, nPos) == rTable[i]);
+        CPPUNIT_ASSERT_EQUAL(i, nPos);
+
+        // behind the deleted word nothing is found, the search stops at the next redline
+        nPos = 0;
+        SwPosition aBehind(*aTextNodes[i], 7);
+        CPPUNIT_ASSERT(rTable.FindAtPosition(aBehind, nPos) == 0);
+        CPPUNIT_ASSERT_EQUAL(i + 1, nPos);
+    }
+
+    CPPUNIT_ASSERT(SwRedlineTable::npos == rIDRA.GetRedlinePos(rUnchanged, USHRT_MAX));
+
+    // more redlines than a sal_uInt16 can count, in a table of our own: every
+    // other character of a paragraph is an insertion
+    const sal_Int32 nRedlineCount = 70000;
+    m_pDoc->getIDocumentContentOperations().AppendTextNode(*aPaM.GetPoint());
+    SwTextNode* pLong = aPaM.GetNode().GetTextNode();
+    OUStringBuffer aText(2 * nRedlineCount);
+    for (sal_Int32 i = 0; i < nRedlineCount; ++i)
+        aText.append("xx");
+    m_pDoc->getIDocumentContentOperations().InsertString(aPaM, aText.makeStringAndClear());
+    {
+        SwRedlineTable aTable;
+        for (sal_Int32 i = 0; i < nRedlineCount; ++i)
+        {
+            SwPaM aIns(*pLong, 2 * i, *pLong, 2 * i + 1);
+            aTable.Insert(new SwRangeRedline(nsRedlineType_t::REDLINE_INSERT, aIns));
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<SwRedlineTable::size_type>(nRedlineCount), aTable.size());
+
+        for (sal_Int32 i = nRedlineCount - 3; i < nRedlineCount; ++i)
+        {
+            const SwRedlineTable::size_type nIdx = i;
+            // inside, at the end of, and behind the i-th redline
+            CPPUNIT_ASSERT_EQUAL(nIdx, aTable.FindFirstEndingAtOrAfter(SwPosition(*pLong, 2 * i)));
+            CPPUNIT_ASSERT_EQUAL(nIdx, aTable.FindFirstEndingAtOrAfter(SwPosition(*pLong, 2 * i + 1)));
+
+            SwRedlineTable::size_type nPos = 0;
+            CPPUNIT_ASSERT(aTable.FindAtPosition(SwPosition(*pLong, 2 * i), nPos) == aTable[nIdx]);
+            CPPUNIT_ASSERT_EQUAL(nIdx, nPos);
+        }
+        CPPUNIT_ASSERT_EQUAL(aTable.size(), aTable.FindFirstEndingAtOrAfter(SwPosition(*pLong, 2 * nRedlineCount)));
+    }
+}
+
+namespace
+{
+    /// Writes a layout cache with one paragraph break per node, like SwLayoutCache::Write() does.
+    void lcl_WriteLayoutCache(SvStream& rStream, const std::vector<sal_uLong>& rIndices,
+                              const std::vector<sal_uInt32>& rChecksums)
+    {
+        SwLayCacheIoImpl aIo(rStream, true);
+        aIo.OpenRec(SW_LAYCACHE_IO_REC_PAGES);
+        aIo.OpenFlagRec(0, 0);
+        aIo.CloseFlagRec();
+        for (size_t i = 0; i < rIndices.size(); ++i)
+        {
+            aIo.OpenRec(SW_LAYCACHE_IO_REC_PARA);
+            aIo.OpenFlagRec(0x02, 8);
+            aIo.GetStream().WriteUInt32(rIndices[i]);
+            aIo.GetStream().WriteUInt32(rChecksums[i]);
+            aIo.CloseFlagRec();
+            aIo.CloseRec(SW_LAYCACHE_IO_REC_PARA);
+        }
+        aIo.CloseRec(SW_LAYCACHE_IO_REC_PAGES);
+    }
+
+    /// Reads the layout cache and returns the number of page breaks which survive validation.
+    size_t lcl_ReadLayoutCache(SvStream& rStream, const SwDoc& rDoc)
+    {
+        rStream.Seek(0);
+        SwLayoutCache aCache;
+        aCache.Read(rStream);
+        SwLayCacheImpl* pImpl = aCache.LockImpl();
+        if (!pImpl)
+            return 0;
+        pImpl->Validate(rDoc);
+        const size_t nRet = pImpl->size();
+        aCache.UnlockImpl();
+        return nRet;
+    }
+}
+
+void SwDocTest::testLayoutCacheChecksum()
+{
+    // the checksum is part of the file format: CRC-32 of the UTF-16LE text, never 0
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(0xad957ab0), SwLayCacheImpl::GetChecksum("abc"));
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(1), SwLayCacheImpl::GetChecksum(OUString()));
+
+    SwNodeIndex aIdx(m_pDoc->GetNodes().GetEndOfContent(), -1);
+    SwPaM aPaM(aIdx);
+    const sal_uLong nStartOfContent = m_pDoc->GetNodes().GetEndOfContent().StartOfSectionNode()->GetIndex();
+    std::vector<sal_uLong> aIndices;
+    std::vector<sal_uInt32> aChecksums;
+    const char* aTexts[] = { "Lorem", "ipsum", "dolor" };
+    for (size_t i = 0; i < SAL_N_ELEMENTS(aTexts); ++i)
+    {
+        m_pDoc->getIDocumentContentOperations().AppendTextNode(*aPaM.GetPoint());
+        m_pDoc->getIDocumentContentOperations().InsertString(aPaM, OUString::createFromAscii(aTexts[i]));
+        const SwTextNode* pTextNd = aPaM.GetNode().GetTextNode();
+        aIndices.push_back(pTextNd->GetIndex() - nStartOfContent);
+        aChecksums.push_back(SwLayCacheImpl::GetChecksum(pTextNd->GetText()));
+    }
+
+    // round trip: all page breaks match the content and are kept
+    {
+        SvMemoryStream aStream;
+        lcl_WriteLayoutCache(aStream, aIndices, aChecksums);
+        CPPUNIT_ASSERT_EQUAL(aIndices.size(), lcl_ReadLayoutCache(aStream, *m_pDoc));
+    }
+
+    // a mismatching checksum drops that page break and all following ones
+    {
+        ++aChecksums[1];
+        SvMemoryStream aStream;
+        lcl_WriteLayoutCache(aStream, aIndices, aChecksums);
+        CPPUNIT_ASSERT_EQUAL(size_t(1), lcl_ReadLayoutCache(aStream, *m_pDoc));
+    }
+}
+
 void SwDocTest::setUp()
 {
     BootstrapFixture::setUp();
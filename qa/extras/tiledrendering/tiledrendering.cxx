@@ -15,6 +15,7 @@
 #include <svx/svdpage.hxx>
 #include <svx/svdview.hxx>
 #include <vcl/svapp.hxx>
+#include <vcl/virdev.hxx>
 #include <crsskip.hxx>
 #include <drawdoc.hxx>
 #include <ndtxt.hxx>
@@ -26,6 +27,11 @@ static const char* DATA_DIRECTORY = "/sw/qa/extras/tiledrendering/data/";
 class SwTiledRenderingTest : public SwModelTestBase
 {
 public:
+    SwTiledRenderingTest()
+        : m_nInvalidations(0)
+    {
+    }
+
     void testRegisterCallback();
     void testPostKeyEvent();
     void testPostMouseEvent();
@@ -34,6 +40,10 @@ public:
     void testResetSelection();
     void testSearch();
     void testDocumentSizeChanged();
+    void testTileCache();
+    void testTileCacheReflow();
+    void testPaintTiles();
+    void testInvalidationCallbacks();
 
     CPPUNIT_TEST_SUITE(SwTiledRenderingTest);
     CPPUNIT_TEST(testRegisterCallback);
@@ -44,6 +54,10 @@ public:
     CPPUNIT_TEST(testResetSelection);
     CPPUNIT_TEST(testSearch);
     CPPUNIT_TEST(testDocumentSizeChanged);
+    CPPUNIT_TEST(testTileCache);
+    CPPUNIT_TEST(testTileCacheReflow);
+    CPPUNIT_TEST(testPaintTiles);
+    CPPUNIT_TEST(testInvalidationCallbacks);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -52,6 +66,7 @@ private:
     void callbackImpl(int nType, const char* pPayload);
     Rectangle m_aInvalidation;
     Size m_aDocumentSize;
+    int m_nInvalidations;
 };
 
 SwXTextDocument* SwTiledRenderingTest::createDoc(const char* pName)
@@ -75,6 +90,7 @@ void SwTiledRenderingTest::callbackImpl(int nType, const char* pPayload)
     {
     case LOK_CALLBACK_INVALIDATE_TILES:
     {
+        ++m_nInvalidations;
         if (m_aInvalidation.IsEmpty())
         {
             uno::Sequence<OUString> aSeq = comphelper::string::convertCommaSeparated(OUString::createFromAscii(pPayload));
@@ -309,6 +325,154 @@ void SwTiledRenderingTest::testDocumentSizeChanged()
 #endif
 }
 
+void SwTiledRenderingTest::testTileCache()
+{
+    SwXTextDocument* pXTextDocument = createDoc("dummy.fodt");
+    SwWrtShell* pWrtShell = pXTextDocument->GetDocShell()->GetWrtShell();
+    ScopedVclPtrInstance<VirtualDevice> pDevice;
+
+    // Replay a small pan/zoom trace: two neighbouring tiles, then the first
+    // one zoomed out, then everything again.
+    const long aTrace[][2] = { { 3840, 0 }, { 3840, 3840 }, { 7680, 0 } };
+    for (int nRound = 0; nRound < 2; ++nRound)
+    {
+        for (const auto& rTile : aTrace)
+            pXTextDocument->paintTile(*pDevice, 256, 256, rTile[1], 0, rTile[0], rTile[0]);
+    }
+    // The first round had to paint, the second one was served from the cache.
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(3), pWrtShell->GetTileCacheMisses());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(3), pWrtShell->GetTileCacheHits());
+
+    // A cached tile is the same as a painted one.
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, 0, 3840, 3840);
+    pDevice->SetMapMode(MapMode(MAP_PIXEL));
+    Bitmap aCached(pDevice->GetBitmap(Point(0, 0), Size(256, 256)));
+    pWrtShell->InvalidateTileCache(nullptr);
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, 0, 3840, 3840);
+    pDevice->SetMapMode(MapMode(MAP_PIXEL));
+    CPPUNIT_ASSERT_EQUAL(aCached.GetChecksum(), pDevice->GetBitmap(Point(0, 0), Size(256, 256)).GetChecksum());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(4), pWrtShell->GetTileCacheMisses());
+
+    // Typing at the start of the document invalidates the top left tile.
+    pWrtShell->Insert("x");
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, 0, 3840, 3840);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(5), pWrtShell->GetTileCacheMisses());
+}
+
+void SwTiledRenderingTest::testTileCacheReflow()
+{
+    SwXTextDocument* pXTextDocument = createDoc("2-pages.odt");
+    SwWrtShell* pWrtShell = pXTextDocument->GetDocShell()->GetWrtShell();
+    ScopedVclPtrInstance<VirtualDevice> pDevice;
+    const long nPage2 = pXTextDocument->getDocumentSize().getHeight() / 2;
+
+    // Cache a tile of the second page, then move the view to the first one.
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, nPage2, 7680, 7680);
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, 0, 7680, 7680);
+
+    // Editing the first page pushes its second paragraph to the second page,
+    // which is not formatted yet: that only happens when painting it.
+    pWrtShell->SttEndDoc(/*bStt=*/true);
+    pWrtShell->SplitNode();
+
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, nPage2, 7680, 7680);
+    pDevice->SetMapMode(MapMode(MAP_PIXEL));
+    Bitmap aTile(pDevice->GetBitmap(Point(0, 0), Size(256, 256)));
+    pWrtShell->InvalidateTileCache(nullptr);
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, nPage2, 7680, 7680);
+    pDevice->SetMapMode(MapMode(MAP_PIXEL));
+    // This was the tile from before the reflow.
+    CPPUNIT_ASSERT_EQUAL(pDevice->GetBitmap(Point(0, 0), Size(256, 256)).GetChecksum(), aTile.GetChecksum());
+
+    // Same when painting a batch of tiles.
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, 0, 7680, 7680);
+    pWrtShell->SttEndDoc(/*bStt=*/true);
+    pWrtShell->SplitNode();
+    std::vector<VirtualDevice*> aDevicePtrs(1, pDevice.get());
+    std::vector<Point> aPositions(1, Point(0, nPage2));
+    pXTextDocument->paintTiles(aDevicePtrs, aPositions, 256, 256, 7680, 7680);
+    pDevice->SetMapMode(MapMode(MAP_PIXEL));
+    aTile = pDevice->GetBitmap(Point(0, 0), Size(256, 256));
+    pWrtShell->InvalidateTileCache(nullptr);
+    pXTextDocument->paintTile(*pDevice, 256, 256, 0, nPage2, 7680, 7680);
+    pDevice->SetMapMode(MapMode(MAP_PIXEL));
+    CPPUNIT_ASSERT_EQUAL(pDevice->GetBitmap(Point(0, 0), Size(256, 256)).GetChecksum(), aTile.GetChecksum());
+}
+
+void SwTiledRenderingTest::testPaintTiles()
+{
+    SwXTextDocument* pXTextDocument = createDoc("dummy.fodt");
+    SwWrtShell* pWrtShell = pXTextDocument->GetDocShell()->GetWrtShell();
+
+    // Paint a 2x2 block of tiles in one go.
+    std::vector< VclPtr<VirtualDevice> > aDevices;
+    std::vector<VirtualDevice*> aDevicePtrs;
+    std::vector<Point> aPositions;
+    for (long nY = 0; nY < 2; ++nY)
+    {
+        for (long nX = 0; nX < 2; ++nX)
+        {
+            aDevices.push_back(VclPtr<VirtualDevice>::Create());
+            aDevicePtrs.push_back(aDevices.back().get());
+            aPositions.push_back(Point(nX * 3840, nY * 3840));
+        }
+    }
+    pXTextDocument->paintTiles(aDevicePtrs, aPositions, 256, 256, 3840, 3840);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(4), pWrtShell->GetTileCacheMisses());
+    for (VirtualDevice* pDevice : aDevicePtrs)
+        CPPUNIT_ASSERT_EQUAL(Size(256, 256), pDevice->GetOutputSizePixel());
+
+    // The batch filled the tile cache, the same as single tiles do.
+    ScopedVclPtrInstance<VirtualDevice> pDevice;
+    pXTextDocument->paintTile(*pDevice, 256, 256, 3840, 3840, 3840, 3840);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(1), pWrtShell->GetTileCacheHits());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(4), pWrtShell->GetTileCacheMisses());
+
+    // Only the tiles not in the cache are painted again.
+    aPositions[0] = Point(7680, 0);
+    pXTextDocument->paintTiles(aDevicePtrs, aPositions, 256, 256, 3840, 3840);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(4), pWrtShell->GetTileCacheHits());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(5), pWrtShell->GetTileCacheMisses());
+
+    // The tiles cut out of the batch are the same as the ones painted one by one.
+    pWrtShell->InvalidateTileCache(nullptr);
+    for (size_t i = 0; i < aDevicePtrs.size(); ++i)
+    {
+        pXTextDocument->paintTile(*pDevice, 256, 256, aPositions[i].X(), aPositions[i].Y(), 3840, 3840);
+        pDevice->SetMapMode(MapMode(MAP_PIXEL));
+        aDevicePtrs[i]->SetMapMode(MapMode(MAP_PIXEL));
+        CPPUNIT_ASSERT_EQUAL(pDevice->GetBitmap(Point(0, 0), Size(256, 256)).GetChecksum(),
+                             aDevicePtrs[i]->GetBitmap(Point(0, 0), Size(256, 256)).GetChecksum());
+    }
+
+    for (VclPtr<VirtualDevice>& pTileDevice : aDevices)
+        pTileDevice.disposeAndClear();
+}
+
+void SwTiledRenderingTest::testInvalidationCallbacks()
+{
+#if !defined(WNT) && !defined(MACOSX)
+    SwXTextDocument* pXTextDocument = createDoc("dummy.fodt");
+    pXTextDocument->registerCallback(&SwTiledRenderingTest::callback, this);
+    SwWrtShell* pWrtShell = pXTextDocument->GetDocShell()->GetWrtShell();
+
+    // Type a few paragraphs in one action: the invalidations are collected
+    // and sent merged at its end, within the budget.
+    pWrtShell->SetInvalidationBudget(1);
+    m_nInvalidations = 0;
+    pWrtShell->StartAllAction();
+    for (int i = 0; i < 10; ++i)
+    {
+        pWrtShell->Insert("x");
+        pWrtShell->SplitNode();
+    }
+    pWrtShell->EndAllAction();
+    // This was one callback for every repainted rectangle.
+    CPPUNIT_ASSERT_EQUAL(1, m_nInvalidations);
+    CPPUNIT_ASSERT(!m_aInvalidation.IsEmpty());
+#endif
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(SwTiledRenderingTest);
 
 CPPUNIT_PLUGIN_IMPLEMENT();
@@ -45,6 +45,7 @@
 
 #include <com/sun/star/lang/Locale.hpp>
 #include <com/sun/star/lang/XMultiServiceFactory.hpp>
+#include <com/sun/star/text/XFootnotesSupplier.hpp>
 #include <com/sun/star/util/SearchOptions.hpp>
 #include <com/sun/star/util/SearchFlags.hpp>
 #include "com/sun/star/util/SearchAlgorithms.hpp"
@@ -81,6 +82,11 @@ public:
     void testFdo85554();
     void testAutoCorr();
     void testMergeDoc();
+    void testMergeDocAcceptAll();
+    void testMergeDocRejectAll();
+    void testAcceptAllRedlineSpecialSections();
+    void testUpdateExpFields();
+    void testCompareDocLarge();
     void testCreatePortions();
     void testBookmarkUndo();
     void testFdo85876();
@@ -93,6 +99,7 @@ public:
     void testUndoCharAttribute();
     void testTdf86639();
     void testTdf90883TableBoxGetCoordinates();
+    void testBookmarksInsertText();
 
     CPPUNIT_TEST_SUITE(SwUiWriterTest);
     CPPUNIT_TEST(testReplaceForward);
@@ -118,6 +125,11 @@ public:
     CPPUNIT_TEST(testFdo85554);
     CPPUNIT_TEST(testAutoCorr);
     CPPUNIT_TEST(testMergeDoc);
+    CPPUNIT_TEST(testMergeDocAcceptAll);
+    CPPUNIT_TEST(testMergeDocRejectAll);
+    CPPUNIT_TEST(testAcceptAllRedlineSpecialSections);
+    CPPUNIT_TEST(testUpdateExpFields);
+    CPPUNIT_TEST(testCompareDocLarge);
     CPPUNIT_TEST(testCreatePortions);
     CPPUNIT_TEST(testBookmarkUndo);
     CPPUNIT_TEST(testFdo85876);
@@ -130,6 +142,7 @@ public:
     CPPUNIT_TEST(testUndoCharAttribute);
     CPPUNIT_TEST(testTdf86639);
     CPPUNIT_TEST(testTdf90883TableBoxGetCoordinates);
+    CPPUNIT_TEST(testBookmarksInsertText);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -695,6 +708,227 @@ void SwUiWriterTest::testMergeDoc()
     getParagraph(7, "");
 }
 
+void SwUiWriterTest::testMergeDocAcceptAll()
+{
+    SwDoc* const pDoc1(createDoc("merge-change1.odt"));
+
+    auto xDoc2Component(loadFromDesktop(
+            getURLFromSrc(DATA_DIRECTORY) + "merge-change2.odt",
+            "com.sun.star.text.TextDocument"));
+    auto pxDoc2Document(
+            dynamic_cast<SwXTextDocument *>(xDoc2Component.get()));
+    CPPUNIT_ASSERT(pxDoc2Document);
+    SwDoc* const pDoc2(pxDoc2Document->GetDocShell()->GetDoc());
+
+    SwEditShell* const pEditShell(pDoc1->GetEditShell());
+    pEditShell->MergeDoc(*pDoc2);
+    const SwRedlineTable::size_type nRedlines = pEditShell->GetRedlineCount();
+    CPPUNIT_ASSERT(nRedlines > 1);
+
+    // accept all redlines in one go: same result as accepting them one by one
+    sw::UndoManager& rUndoManager = pDoc1->GetUndoManager();
+    const size_t nUndoCount = rUndoManager.GetUndoActionCount();
+    CPPUNIT_ASSERT(pEditShell->AcceptAllRedline(true));
+    CPPUNIT_ASSERT_EQUAL(SwRedlineTable::size_type(0), pEditShell->GetRedlineCount());
+    // ... recorded as a single undo action
+    CPPUNIT_ASSERT_EQUAL(nUndoCount + 1, rUndoManager.GetUndoActionCount());
+
+    CPPUNIT_ASSERT_EQUAL(7, getParagraphs());
+    getParagraph(1, "Para One: Two Three Four Five");
+    getParagraph(2, "Para Two: One Three Four Five");
+    getParagraph(3, "Para Three: One Two Four Five");
+    getParagraph(4, "Para Four: One Two Three Four Five");
+    getParagraph(5, "Para Six: One Three Four Five");
+    getParagraph(6, "");
+    getParagraph(7, "");
+
+    // a single Undo brings back every redline
+    rUndoManager.Undo();
+    CPPUNIT_ASSERT_EQUAL(nRedlines, pEditShell->GetRedlineCount());
+}
+
+void SwUiWriterTest::testMergeDocRejectAll()
+{
+    SwDoc* const pDoc1(createDoc("merge-change1.odt"));
+    std::vector<OUString> aOrigTexts;
+    for (int i = 1; i <= getParagraphs(); ++i)
+        aOrigTexts.push_back(getParagraph(i)->getString());
+
+    auto xDoc2Component(loadFromDesktop(
+            getURLFromSrc(DATA_DIRECTORY) + "merge-change2.odt",
+            "com.sun.star.text.TextDocument"));
+    auto pxDoc2Document(
+            dynamic_cast<SwXTextDocument *>(xDoc2Component.get()));
+    CPPUNIT_ASSERT(pxDoc2Document);
+    SwDoc* const pDoc2(pxDoc2Document->GetDocShell()->GetDoc());
+
+    SwEditShell* const pEditShell(pDoc1->GetEditShell());
+    pEditShell->MergeDoc(*pDoc2);
+    const SwRedlineTable::size_type nRedlines = pEditShell->GetRedlineCount();
+    CPPUNIT_ASSERT(nRedlines > 1);
+
+    // rejecting all redlines in one go gives back the original document
+    sw::UndoManager& rUndoManager = pDoc1->GetUndoManager();
+    const size_t nUndoCount = rUndoManager.GetUndoActionCount();
+    CPPUNIT_ASSERT(pEditShell->AcceptAllRedline(false));
+    CPPUNIT_ASSERT_EQUAL(SwRedlineTable::size_type(0), pEditShell->GetRedlineCount());
+    CPPUNIT_ASSERT_EQUAL(nUndoCount + 1, rUndoManager.GetUndoActionCount());
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(aOrigTexts.size()), getParagraphs());
+    for (size_t i = 0; i < aOrigTexts.size(); ++i)
+        getParagraph(i + 1, aOrigTexts[i]);
+
+    rUndoManager.Undo();
+    CPPUNIT_ASSERT_EQUAL(nRedlines, pEditShell->GetRedlineCount());
+}
+
+void SwUiWriterTest::testAcceptAllRedlineSpecialSections()
+{
+    // tracked insertions in the body, a header and a footnote: the special
+    // sections are in front of the body in the nodes array
+    SwDoc* const pDoc = createDoc();
+    SwEditShell* const pEditShell(pDoc->GetEditShell());
+
+    uno::Reference<beans::XPropertySet> xPageStyle(getStyles("PageStyles")->getByName("Standard"), uno::UNO_QUERY);
+    xPageStyle->setPropertyValue("HeaderIsOn", uno::makeAny(true));
+    uno::Reference<beans::XPropertySet> xDocProps(mxComponent, uno::UNO_QUERY);
+    xDocProps->setPropertyValue("RecordChanges", uno::makeAny(true));
+
+    uno::Reference<text::XText> xHeaderText = getProperty< uno::Reference<text::XText> >(xPageStyle, "HeaderText");
+    xHeaderText->insertString(xHeaderText->getEnd(), "Header", false);
+
+    uno::Reference<text::XTextDocument> xTextDocument(mxComponent, uno::UNO_QUERY);
+    uno::Reference<text::XText> xBodyText = xTextDocument->getText();
+    xBodyText->insertString(xBodyText->getEnd(), "Body", false);
+    uno::Reference<lang::XMultiServiceFactory> xFactory(mxComponent, uno::UNO_QUERY);
+    uno::Reference<text::XTextContent> xFootnote(xFactory->createInstance("com.sun.star.text.Footnote"), uno::UNO_QUERY);
+    xBodyText->insertTextContent(xBodyText->getEnd(), xFootnote, false);
+    uno::Reference<text::XText> xFootnoteText(xFootnote, uno::UNO_QUERY);
+    xFootnoteText->insertString(xFootnoteText->getEnd(), "Footnote", false);
+
+    const SwRedlineTable::size_type nRedlines = pEditShell->GetRedlineCount();
+    CPPUNIT_ASSERT(nRedlines >= 3);
+    uno::Reference<text::XFootnotesSupplier> xFootnotesSupplier(mxComponent, uno::UNO_QUERY);
+    uno::Reference<container::XIndexAccess> xFootnotes(xFootnotesSupplier->getFootnotes(), uno::UNO_QUERY);
+
+    // accepting keeps all of the text
+    sw::UndoManager& rUndoManager = pDoc->GetUndoManager();
+    const size_t nUndoCount = rUndoManager.GetUndoActionCount();
+    CPPUNIT_ASSERT(pEditShell->AcceptAllRedline(true));
+    CPPUNIT_ASSERT_EQUAL(SwRedlineTable::size_type(0), pEditShell->GetRedlineCount());
+    CPPUNIT_ASSERT_EQUAL(nUndoCount + 1, rUndoManager.GetUndoActionCount());
+    CPPUNIT_ASSERT_EQUAL(OUString("Header"), xHeaderText->getString());
+    CPPUNIT_ASSERT_EQUAL(OUString("Body"), getParagraph(1)->getString());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), xFootnotes->getCount());
+    CPPUNIT_ASSERT_EQUAL(OUString("Footnote"), xFootnoteText->getString());
+
+    rUndoManager.Undo();
+    CPPUNIT_ASSERT_EQUAL(nRedlines, pEditShell->GetRedlineCount());
+
+    // rejecting removes all of it, the footnote included
+    CPPUNIT_ASSERT(pEditShell->AcceptAllRedline(false));
+    CPPUNIT_ASSERT_EQUAL(SwRedlineTable::size_type(0), pEditShell->GetRedlineCount());
+    CPPUNIT_ASSERT_EQUAL(OUString(), xHeaderText->getString());
+    CPPUNIT_ASSERT_EQUAL(OUString(), getParagraph(1)->getString());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(0), xFootnotes->getCount());
+
+    rUndoManager.Undo();
+    CPPUNIT_ASSERT_EQUAL(nRedlines, pEditShell->GetRedlineCount());
+}
+
+void SwUiWriterTest::testUpdateExpFields()
+{
+    // A = 1, show A, B = 5, show B: one field in each paragraph
+    SwDoc* const pDoc = createDoc();
+    SwXTextDocument* pTextDoc = dynamic_cast<SwXTextDocument *>(mxComponent.get());
+    SwWrtShell* pWrtShell = pTextDoc->GetDocShell()->GetWrtShell();
+    SwGetExpFieldType* pGetTyp = static_cast<SwGetExpFieldType*>(pWrtShell->GetFieldType(0, RES_GETEXPFLD));
+
+    SwSetExpFieldType* pTypA = static_cast<SwSetExpFieldType*>(pWrtShell->InsertFieldType(SwSetExpFieldType(pDoc, "A")));
+    SwSetExpField aSetA(pTypA, "1");
+    pWrtShell->Insert(aSetA);
+    pWrtShell->SplitNode();
+    SwGetExpField aGetA(pGetTyp, "A", pTypA->GetType());
+    pWrtShell->Insert(aGetA);
+    pWrtShell->SplitNode();
+    SwSetExpFieldType* pTypB = static_cast<SwSetExpFieldType*>(pWrtShell->InsertFieldType(SwSetExpFieldType(pDoc, "B")));
+    SwSetExpField aSetB(pTypB, "5");
+    pWrtShell->Insert(aSetB);
+    pWrtShell->SplitNode();
+    SwGetExpField aGetB(pGetTyp, "B", pTypB->GetType());
+    pWrtShell->Insert(aGetB);
+
+    pDoc->getIDocumentFieldsAccess().UpdateExpFields(NULL, true);
+    pWrtShell->CalcLayout();
+    xmlDocPtr pXmlDoc = parseLayoutDump();
+    assertXPath(pXmlDoc, "/root/page/body/txt[1]/Special[@nType='POR_FLD']", "rText", "1");
+    assertXPath(pXmlDoc, "/root/page/body/txt[2]/Special[@nType='POR_FLD']", "rText", "1");
+    assertXPath(pXmlDoc, "/root/page/body/txt[3]/Special[@nType='POR_FLD']", "rText", "5");
+    assertXPath(pXmlDoc, "/root/page/body/txt[4]/Special[@nType='POR_FLD']", "rText", "5");
+
+    // change A: only the fields showing A get a new text
+    pWrtShell->SttEndDoc(true);
+    SwField* pField = pWrtShell->GetCurField();
+    CPPUNIT_ASSERT(pField);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(RES_SETEXPFLD), pField->GetTyp()->Which());
+    pField->SetPar2("2");
+    pDoc->getIDocumentFieldsAccess().UpdateExpFields(NULL, true);
+    pWrtShell->CalcLayout();
+    discardDumpedLayout();
+    pXmlDoc = parseLayoutDump();
+    assertXPath(pXmlDoc, "/root/page/body/txt[1]/Special[@nType='POR_FLD']", "rText", "2");
+    assertXPath(pXmlDoc, "/root/page/body/txt[2]/Special[@nType='POR_FLD']", "rText", "2");
+    assertXPath(pXmlDoc, "/root/page/body/txt[3]/Special[@nType='POR_FLD']", "rText", "5");
+    assertXPath(pXmlDoc, "/root/page/body/txt[4]/Special[@nType='POR_FLD']", "rText", "5");
+}
+
+void SwUiWriterTest::testCompareDocLarge()
+{
+    // enough paragraphs to have the line diff split at the unique lines
+    const int nParaCount = 3000;
+    SwDoc* const pDoc1(createDoc());
+
+    auto xDoc2Component(loadFromDesktop(
+            "private:factory/swriter", "com.sun.star.text.TextDocument"));
+    auto pxDoc2Document(
+            dynamic_cast<SwXTextDocument *>(xDoc2Component.get()));
+    CPPUNIT_ASSERT(pxDoc2Document);
+    SwDoc* const pDoc2(pxDoc2Document->GetDocShell()->GetDoc());
+
+    // the old version has every paragraph, the new one misses one of them
+    // and has an additional one
+    SwNodeIndex aIdx1(pDoc1->GetNodes().GetEndOfContent(), -1);
+    SwPaM aPaM1(aIdx1);
+    SwNodeIndex aIdx2(pDoc2->GetNodes().GetEndOfContent(), -1);
+    SwPaM aPaM2(aIdx2);
+    for (int i = 0; i < nParaCount; ++i)
+    {
+        const OUString aText("Paragraph " + OUString::number(i));
+        pDoc2->getIDocumentContentOperations().InsertString(aPaM2, aText);
+        pDoc2->getIDocumentContentOperations().AppendTextNode(*aPaM2.GetPoint());
+        if (i != 1000)
+        {
+            pDoc1->getIDocumentContentOperations().InsertString(aPaM1, aText);
+            pDoc1->getIDocumentContentOperations().AppendTextNode(*aPaM1.GetPoint());
+        }
+        if (i == 2000)
+        {
+            pDoc1->getIDocumentContentOperations().InsertString(aPaM1, "Inserted paragraph");
+            pDoc1->getIDocumentContentOperations().AppendTextNode(*aPaM1.GetPoint());
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(2L, pDoc1->CompareDoc(*pDoc2));
+
+    // one deletion and one insertion, nothing else
+    const SwRedlineTable& rTable = pDoc1->getIDocumentRedlineAccess().GetRedlineTable();
+    CPPUNIT_ASSERT_EQUAL(SwRedlineTable::size_type(2), rTable.size());
+    CPPUNIT_ASSERT_EQUAL(nsRedlineType_t::REDLINE_DELETE, rTable[0]->GetType());
+    CPPUNIT_ASSERT_EQUAL(OUString("Paragraph 1000"), rTable[0]->GetText());
+    CPPUNIT_ASSERT_EQUAL(nsRedlineType_t::REDLINE_INSERT, rTable[1]->GetType());
+    CPPUNIT_ASSERT_EQUAL(OUString("Inserted paragraph"), rTable[1]->GetText());
+}
+
 void SwUiWriterTest::testCreatePortions()
 {
     createDoc("uno-cycle.odt");
@@ -980,6 +1214,49 @@ void SwUiWriterTest::testTdf90883TableBoxGetCoordinates()
     CPPUNIT_ASSERT_EQUAL( 2, (int)pos.Y() );
 }
 
+void SwUiWriterTest::testBookmarksInsertText()
+{
+    SwDoc* pDoc = createDoc();
+    SwNodeIndex aIdx(pDoc->GetNodes().GetEndOfContent(), -1);
+    SwPaM aPaM(aIdx);
+    pDoc->getIDocumentContentOperations().InsertString(aPaM, OUString("abcdef"));
+    SwTextNode* pTextNode = aIdx.GetNode().GetTextNode();
+    IDocumentMarkAccess* const pMarkAccess = pDoc->getIDocumentMarkAccess();
+
+    // Lots of collapsed marks all over the paragraph, and two expanded ones
+    // ending and starting at the insert position.
+    for (sal_Int32 i = 0; i < 70; ++i)
+    {
+        SwPaM aMarkPaM(SwPosition(aIdx, SwIndex(pTextNode, i % 7)));
+        pMarkAccess->makeMark(aMarkPaM, "Mark" + OUString::number(i), IDocumentMarkAccess::MarkType::BOOKMARK);
+    }
+    SwPaM aBefore(SwPosition(aIdx, SwIndex(pTextNode, 1)), SwPosition(aIdx, SwIndex(pTextNode, 3)));
+    pMarkAccess->makeMark(aBefore, OUString("Before"), IDocumentMarkAccess::MarkType::BOOKMARK);
+    SwPaM aAfter(SwPosition(aIdx, SwIndex(pTextNode, 3)), SwPosition(aIdx, SwIndex(pTextNode, 5)));
+    pMarkAccess->makeMark(aAfter, OUString("After"), IDocumentMarkAccess::MarkType::BOOKMARK);
+
+    SwPaM aInsertPaM(SwPosition(aIdx, SwIndex(pTextNode, 3)));
+    pDoc->getIDocumentContentOperations().InsertString(aInsertPaM, OUString("X"));
+    CPPUNIT_ASSERT_EQUAL(OUString("abcXdef"), pTextNode->GetText());
+
+    // Bookmarks don't grow to either side when typing next to them.
+    IDocumentMarkAccess::const_iterator_t ppMark = pMarkAccess->findMark("Before");
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), (*ppMark)->GetMarkStart().nContent.GetIndex());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(3), (*ppMark)->GetMarkEnd().nContent.GetIndex());
+    ppMark = pMarkAccess->findMark("After");
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(4), (*ppMark)->GetMarkStart().nContent.GetIndex());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(6), (*ppMark)->GetMarkEnd().nContent.GetIndex());
+
+    // The collapsed ones stay in front of the inserted text, or move with
+    // the text after it.
+    for (sal_Int32 i = 0; i < 70; ++i)
+    {
+        ppMark = pMarkAccess->findMark("Mark" + OUString::number(i));
+        const sal_Int32 nOld = i % 7;
+        CPPUNIT_ASSERT_EQUAL(nOld <= 3 ? nOld : nOld + 1, (*ppMark)->GetMarkPos().nContent.GetIndex());
+    }
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(SwUiWriterTest);
 CPPUNIT_PLUGIN_IMPLEMENT();
 
@@ -344,6 +344,31 @@ class CheckTable(unittest.TestCase):
         self.assertEqual( xTable.Data, ((1,2,3), (4,55,66), (7,88,99), (10,1111,1212)))
         xDoc.dispose()
 
+    def test_getset_dataarray(self):
+        xDoc = CheckTable._uno.openEmptyWriterDoc()
+        # insert table
+        xTable = xDoc.createInstance("com.sun.star.text.TextTable")
+        xTable.initialize(4, 3)
+        xCursor = xDoc.Text.createTextCursor()
+        xDoc.Text.insertTextContent(xCursor, xTable, False)
+        # last row sums up the columns above
+        xTable.getCellByName("A4").Formula = "sum <A1:A3>"
+        xTable.getCellByName("B4").Formula = "sum <B1:B3>"
+        xTable.getCellByName("C4").Formula = "sum <C1:C3>"
+        # roundtrip
+        xRange = xTable.getCellRangeByName("A1:C3")
+        xRange.DataArray = ((1,2,3), (4,"foo",6), (7,8,9))
+        self.assertEqual( xRange.DataArray, ((1,2,3), (4,"foo",6), (7,8,9)))
+        # formulas depending on the range got updated once it was set
+        self.assertEqual( xTable.getCellByName("A4").Value, 12)
+        self.assertEqual( xTable.getCellByName("C4").Value, 18)
+        # same for XChartDataArray::setData
+        xTable.ChartColumnAsLabel = False
+        xTable.ChartRowAsLabel = False
+        xTable.Data = ((10,20,30), (40,50,60), (70,80,90), (0,0,0))
+        self.assertEqual( xTable.getCellByName("B2").Value, 50)
+        xDoc.dispose()
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -25,6 +25,7 @@
 #include <svx/unomod.hxx>
 #include <algorithm>
 #include <map>
+#include <unordered_map>
 #include <list>
 #include <vector>
 #include <accmap.hxx>
@@ -524,30 +525,23 @@ public:
 
 void SwAccessibleEventList_Impl::MoveInvalidXAccToEnd()
 {
-    size_t nSize = size();
-    if (nSize < 2 )
+    if (size() < 2 )
     {
         return;
     }
+    // Relink the list nodes instead of copying the events: iterators kept in
+    // the event map stay valid this way.
     SwAccessibleEventList_Impl lstEvent;
     iterator li = begin();
-    for ( ;li != end();)
+    while ( li != end() )
     {
-        SwAccessibleEvent_Impl e = *li;
-        if (e.IsNoXaccParentFrm())
-        {
-            iterator liNext = li;
-            ++liNext;
-            erase(li);
-            li = liNext;
-            lstEvent.insert(lstEvent.end(),e);
-        }
-        else
-            ++li;
+        iterator liNext = li;
+        ++liNext;
+        if (li->IsNoXaccParentFrm())
+            lstEvent.splice(lstEvent.end(), *this, li);
+        li = liNext;
     }
-    OSL_ENSURE(size() + lstEvent.size() == nSize ,"");
-    insert(end(),lstEvent.begin(),lstEvent.end());
-    OSL_ENSURE(size() == nSize ,"");
+    splice(end(), lstEvent);
 }
 
 // The shape list is filled if an accessible shape is destroyed. It
@@ -571,34 +565,38 @@ public:
 
 struct SwAccessibleChildFunc
 {
+    static const void* GetKey( const SwAccessibleChild& r )
+    {
+        return r.GetSwFrm()
+               ? static_cast < const void * >( r.GetSwFrm())
+               : ( r.GetDrawObject()
+                   ? static_cast < const void * >( r.GetDrawObject() )
+                   : static_cast < const void * >( r.GetWindow() ) );
+    }
+    size_t operator()( const SwAccessibleChild& r ) const
+    {
+        return std::hash< const void * >()( GetKey( r ) );
+    }
     bool operator()( const SwAccessibleChild& r1,
                          const SwAccessibleChild& r2 ) const
     {
-        const void *p1 = r1.GetSwFrm()
-                         ? static_cast < const void * >( r1.GetSwFrm())
-                         : ( r1.GetDrawObject()
-                             ? static_cast < const void * >( r1.GetDrawObject() )
-                             : static_cast < const void * >( r1.GetWindow() ) );
-        const void *p2 = r2.GetSwFrm()
-                         ? static_cast < const void * >( r2.GetSwFrm())
-                         : ( r2.GetDrawObject()
-                             ? static_cast < const void * >( r2.GetDrawObject() )
-                             : static_cast < const void * >( r2.GetWindow() ) );
-        return p1 < p2;
+        return GetKey( r1 ) == GetKey( r2 );
     }
 };
 
+// Events are looked up for every frame that is invalidated, which may be all
+// of them on a reflow, so use a hash map.
 class SwAccessibleEventMap_Impl
 {
 public:
     typedef SwAccessibleChild                                           key_type;
     typedef SwAccessibleEventList_Impl::iterator                        mapped_type;
     typedef std::pair<const key_type,mapped_type>                       value_type;
-    typedef SwAccessibleChildFunc                                       key_compare;
-    typedef std::map<key_type,mapped_type,key_compare>::iterator        iterator;
-    typedef std::map<key_type,mapped_type,key_compare>::const_iterator  const_iterator;
+    typedef std::unordered_map<key_type,mapped_type,SwAccessibleChildFunc,SwAccessibleChildFunc> map_type;
+    typedef map_type::iterator                                          iterator;
+    typedef map_type::const_iterator                                    const_iterator;
 private:
-    std::map <key_type,mapped_type,key_compare> maMap;
+    map_type maMap;
 public:
     iterator begin() { return maMap.begin(); }
     iterator end() { return maMap.end(); }
@@ -1052,8 +1050,10 @@ void SwAccessibleMap::AppendEvent( const SwAccessibleEvent_Impl& rEvent )
             }
             if( bAppendEvent )
             {
-                mpEvents->erase( (*aIter).second );
-                (*aIter).second = mpEvents->insert( mpEvents->end(), aEvent );
+                // Update the queued event in place and move it to the back,
+                // the iterator in the map stays valid.
+                *(*aIter).second = aEvent;
+                mpEvents->splice( mpEvents->end(), *mpEvents, (*aIter).second );
             }
             else
             {
@@ -61,9 +61,9 @@ namespace {
             return;
         }
 
-        const sal_uInt16 nIdxOfFirstRedlineForTextNode =
+        const SwRedlineTable::size_type nIdxOfFirstRedlineForTextNode =
                     pIDocChangeTrack->GetRedlinePos( rTextNode, USHRT_MAX );
-        if ( nIdxOfFirstRedlineForTextNode == USHRT_MAX )
+        if ( nIdxOfFirstRedlineForTextNode == SwRedlineTable::npos )
         {
             // nothing to do --> empty change track text markup lists.
             return;
@@ -78,8 +78,8 @@ namespace {
 
         // iteration over the redlines which overlap with the text node.
         const SwRedlineTable& rRedlineTable = pIDocChangeTrack->GetRedlineTable();
-        const sal_uInt16 nRedlineCount( rRedlineTable.size() );
-        for ( sal_uInt16 nActRedline = nIdxOfFirstRedlineForTextNode;
+        const SwRedlineTable::size_type nRedlineCount( rRedlineTable.size() );
+        for ( SwRedlineTable::size_type nActRedline = nIdxOfFirstRedlineForTextNode;
               nActRedline < nRedlineCount;
               ++nActRedline)
         {
@@ -27,27 +27,31 @@
 static const sal_uInt16 nBlockGrowSize = 20;
 
 #if OSL_DEBUG_LEVEL > 2
-#define CHECKIDX( p, n, i, c ) CheckIdx( p, n, i, c );
-void CheckIdx( BlockInfo** ppInf, sal_uInt16 nBlock, sal_uLong nSize, sal_uInt16 nCur )
+#define CHECKIDX( p, n, i, c, u ) CheckIdx( p, n, i, c, u );
+void CheckIdx( BlockInfo** ppInf, sal_uInt16 nBlock, sal_uLong nSize,
+               sal_uInt16 nCur, sal_uInt16 nUpdBlock )
 {
     assert( !nSize || nCur < nBlock ); // BigPtrArray: CurIndex invalid
+    assert( nUpdBlock <= nBlock ); // BigPtrArray: UpdBlock invalid
 
     sal_uLong nIdx = 0;
     for( sal_uInt16 nCnt = 0; nCnt < nBlock; ++nCnt, ++ppInf )
     {
         nIdx += (*ppInf)->nElem;
-        // Array with holes is not allowed
-        assert( !nCnt || (*(ppInf-1))->nEnd + 1 == (*ppInf)->nStart );
+        assert( (*ppInf)->nIndex == nCnt ); // block position out of sync
+        // Array with holes is not allowed (outdated indices are skipped)
+        assert( !nCnt || nCnt >= nUpdBlock ||
+                (*(ppInf-1))->nEnd + 1 == (*ppInf)->nStart );
     }
     assert(nIdx == nSize); // invalid count in nSize
 }
 #else
-#define CHECKIDX( p, n, i, c )
+#define CHECKIDX( p, n, i, c, u )
 #endif
 
 BigPtrArray::BigPtrArray()
 {
-    nBlock = nCur = 0;
+    nBlock = nCur = nUpdBlock = 0;
     nSize = 0;
     nMaxBlock = nBlockGrowSize;
     ppInf = new BlockInfo* [ nMaxBlock ];
@@ -92,58 +96,91 @@ ElementPtr BigPtrArray::operator[]( sal_uLong idx ) const
 /** Search a block at a given position */
 sal_uInt16 BigPtrArray::Index2Block( sal_uLong pos ) const
 {
+    BlockInfo* p;
+    // Recalculate outdated indices only until the block containing pos is
+    // reached. All blocks in front of nUpdBlock are valid afterwards and
+    // contain the position.
+    if( nUpdBlock < nBlock &&
+        ( !nUpdBlock || ppInf[ nUpdBlock-1 ]->nEnd < pos ) )
+    {
+        sal_uLong idx = nUpdBlock ? ppInf[ nUpdBlock-1 ]->nEnd + 1 : 0;
+        do
+        {
+            p = ppInf[ nUpdBlock++ ];
+            p->nStart = idx;
+            idx += p->nElem;
+            p->nEnd = idx - 1;
+        } while( nUpdBlock < nBlock && idx <= pos );
+    }
+
     // last used block?
-    BlockInfo* p = ppInf[ nCur ];
-    if( p->nStart <= pos && p->nEnd >= pos )
-        return nCur;
+    if( nCur < nUpdBlock )
+    {
+        p = ppInf[ nCur ];
+        if( p->nStart <= pos && p->nEnd >= pos )
+            return nCur;
+    }
     // Index = 0?
     if( !pos )
         return 0;
 
     // following one?
-    if( nCur < ( nBlock - 1 ) )
+    if( nCur + 1 < nUpdBlock )
     {
         p = ppInf[ nCur+1 ];
         if( p->nStart <= pos && p->nEnd >= pos )
             return nCur+1;
     }
     // previous one?
-    else if( pos < p->nStart && nCur > 0 )
+    else if( nCur > 0 && nCur <= nUpdBlock )
     {
         p = ppInf[ nCur-1 ];
         if( p->nStart <= pos && p->nEnd >= pos )
             return nCur-1;
     }
 
-    // binary search: always successful
-    sal_uInt16 lower = 0, upper = nBlock - 1;
-    sal_uInt16 cur = 0;
+    // binary search over the valid blocks: always successful
+    sal_uInt16 lower = 0, upper = nUpdBlock - 1;
     for(;;)
     {
-        sal_uInt16 n = lower + ( upper - lower ) / 2;
-        cur = ( n == cur ) ? n+1 : n;
+        sal_uInt16 cur = lower + ( upper - lower ) / 2;
         p = ppInf[ cur ];
-        if( p->nStart <= pos && p->nEnd >= pos )
-            return cur;
-
-        if( p->nStart > pos )
-            upper = cur;
+        if( p->nEnd < pos )
+            lower = cur + 1;
+        else if( p->nStart > pos )
+            upper = cur - 1;
         else
-            lower = cur;
+            return cur;
     }
 }
 
-/** Update all index areas
+/** Mark all following index areas as outdated
+
+    The indices are recalculated on demand by Index2Block() and
+    ValidateIndex().
 
     @param pos last correct block (starting point)
 */
 void BigPtrArray::UpdIndex( sal_uInt16 pos )
 {
-    BlockInfo** pp = ppInf + pos;
-    sal_uLong idx = (*pp)->nEnd + 1;
-    while( ++pos < nBlock )
+    if( nUpdBlock > pos + 1 )
+        nUpdBlock = pos + 1;
+}
+
+/** Recalculate the outdated index areas up to a given block
+
+    @param pos last block that must have correct indices afterwards
+*/
+void BigPtrArray::ValidateIndex( sal_uInt16 pos ) const
+{
+    assert(pos < nBlock); // ValidateIndex: block out of bounds
+    if( pos < nUpdBlock )
+        return;
+
+    sal_uLong idx = nUpdBlock ? ppInf[ nUpdBlock-1 ]->nEnd + 1 : 0;
+    while( nUpdBlock <= pos )
     {
-        BlockInfo* p = *++pp;
+        BlockInfo* p = ppInf[ nUpdBlock++ ];
         p->nStart = idx;
         idx += p->nElem;
         p->nEnd = idx - 1;
@@ -167,10 +204,14 @@ BlockInfo* BigPtrArray::InsBlock( sal_uInt16 pos )
         nMaxBlock += nBlockGrowSize;
         ppInf = ppNew;
     }
+    if( pos )
+        ValidateIndex( pos-1 );
     if( pos != nBlock )
     {
         memmove( ppInf + pos+1, ppInf + pos,
                  ( nBlock - pos ) * sizeof( BlockInfo* ));
+        for( sal_uInt16 n = pos+1; n <= nBlock; ++n )
+            ppInf[ n ]->nIndex = n;
     }
     ++nBlock;
     BlockInfo* p = new BlockInfo;
@@ -181,8 +222,12 @@ BlockInfo* BigPtrArray::InsBlock( sal_uInt16 pos )
     else
         p->nStart = p->nEnd = 0;
 
+    // the new block is empty, so the indices behind it do not change
+    ++nUpdBlock;
+
     p->nEnd--;  // no elements
     p->nElem = 0;
+    p->nIndex = pos;
     p->pData = new ElementPtr [ MAXENTRY ];
     p->pBigArr = this;
     return p;
@@ -191,6 +236,8 @@ BlockInfo* BigPtrArray::InsBlock( sal_uInt16 pos )
 void BigPtrArray::BlockDel( sal_uInt16 nDel )
 {
     nBlock = nBlock - nDel;
+    if( nUpdBlock > nBlock )
+        nUpdBlock = nBlock;
     if( nMaxBlock - nBlock > nBlockGrowSize )
     {
         // than shrink array
@@ -205,7 +252,7 @@ void BigPtrArray::BlockDel( sal_uInt16 nDel )
 
 void BigPtrArray::Insert( const ElementPtr& rElem, sal_uLong pos )
 {
-    CHECKIDX( ppInf, nBlock, nSize, nCur );
+    CHECKIDX( ppInf, nBlock, nSize, nCur, nUpdBlock );
 
     BlockInfo* p;
     sal_uInt16 cur;
@@ -218,6 +265,7 @@ void BigPtrArray::Insert( const ElementPtr& rElem, sal_uLong pos )
     {
         // special case: insert at end
         cur = nBlock - 1;
+        ValidateIndex( cur );
         p = ppInf[ cur ];
         if( p->nElem == MAXENTRY )
             // the last block is full, create a new one
@@ -298,12 +346,12 @@ void BigPtrArray::Insert( const ElementPtr& rElem, sal_uLong pos )
     if( cur != ( nBlock - 1 ) ) UpdIndex( cur );
     nCur = cur;
 
-    CHECKIDX( ppInf, nBlock, nSize, nCur );
+    CHECKIDX( ppInf, nBlock, nSize, nCur, nUpdBlock );
 }
 
 void BigPtrArray::Remove( sal_uLong pos, sal_uLong n )
 {
-    CHECKIDX( ppInf, nBlock, nSize, nCur );
+    CHECKIDX( ppInf, nBlock, nSize, nCur, nUpdBlock );
 
     sal_uInt16 nBlkdel = 0;              // deleted blocks
     sal_uInt16 cur = Index2Block( pos ); // current block number
@@ -358,6 +406,8 @@ void BigPtrArray::Remove( sal_uLong pos, sal_uLong n )
         {
             memmove( ppInf + nBlk1del, ppInf + nBlk1del + nBlkdel,
                      ( nBlock - nBlkdel - nBlk1del ) * sizeof( BlockInfo* ) );
+            for( sal_uInt16 i = nBlk1del; i < nBlock - nBlkdel; ++i )
+                ppInf[ i ]->nIndex = i;
 
             // UpdateIdx updates the successor thus start before first elem
             if( !nBlk1 )
@@ -383,7 +433,7 @@ void BigPtrArray::Remove( sal_uLong pos, sal_uLong n )
     if( nBlock > ( nSize / ( MAXENTRY / 2 ) ) )
         Compress();
 
-    CHECKIDX( ppInf, nBlock, nSize, nCur );
+    CHECKIDX( ppInf, nBlock, nSize, nCur, nUpdBlock );
 }
 
 void BigPtrArray::Replace( sal_uLong idx, const ElementPtr& rElem)
@@ -399,7 +449,7 @@ void BigPtrArray::Replace( sal_uLong idx, const ElementPtr& rElem)
 /** Compress the array */
 sal_uInt16 BigPtrArray::Compress( short nMax )
 {
-    CHECKIDX( ppInf, nBlock, nSize, nCur );
+    CHECKIDX( ppInf, nBlock, nSize, nCur, nUpdBlock );
 
     // Iterate over InfoBlock array from beginning to end. If there is a deleted
     // block in between so move all following ones accordingly. The pointer <pp>
@@ -472,6 +522,7 @@ sal_uInt16 BigPtrArray::Compress( short nMax )
 
         if( p ) // BlockInfo was not deleted
         {
+            p->nIndex = sal_uInt16( qq - ppInf );
             *qq++ = p; // adjust to correct position
 
             // keep the potentially existing last half-full block
@@ -487,15 +538,13 @@ sal_uInt16 BigPtrArray::Compress( short nMax )
     if( nBlkdel )
         BlockDel( nBlkdel );
 
-    // and re-index
-    p = ppInf[ 0 ];
-    p->nEnd = p->nElem - 1;
-    UpdIndex( 0 );
+    // and re-index (lazily)
+    nUpdBlock = 0;
 
     if( nCur >= nFirstChgPos )
         nCur = 0;
 
-    CHECKIDX( ppInf, nBlock, nSize, nCur );
+    CHECKIDX( ppInf, nBlock, nSize, nCur, nUpdBlock );
 
     return nFirstChgPos;
 }
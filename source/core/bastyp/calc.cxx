@@ -185,29 +185,6 @@ _CalcOp* FindOperator( const OUString& rSrch )
                               OperatorCompare ));
 }
 
-SwHash* Find( const OUString& rStr, SwHash* const * ppTable,
-              sal_uInt16 nTableSize, sal_uInt16* pPos )
-{
-    sal_uLong ii = 0;
-    for( sal_Int32 n = 0; n < rStr.getLength(); ++n )
-    {
-        ii = ii << 1 ^ rStr[n];
-    }
-    ii %= nTableSize;
-
-    if( pPos )
-        *pPos = static_cast<sal_uInt16>(ii);
-
-    for( SwHash* pEntry = *(ppTable+ii); pEntry; pEntry = pEntry->pNext )
-    {
-        if( rStr == pEntry->aStr )
-        {
-            return pEntry;
-        }
-    }
-    return 0;
-}
-
 inline LanguageType GetDocAppScriptLang( SwDoc& rDoc )
 {
     return static_cast<const SvxLanguageItem&>(rDoc.GetDefault(
@@ -239,9 +216,10 @@ SwCalc::SwCalc( SwDoc& rD )
     , eCurrOper( CALC_NAME )
     , eCurrListOper( CALC_NAME )
     , eError( CALC_NOERR )
+    , m_pFormula( 0 )
+    , m_nTokenPos( 0 )
 {
     aErrExpr.aStr = "~C_ERR~";
-    memset( VarTable, 0, sizeof(VarTable) );
     LanguageType eLang = GetDocAppScriptLang( rDoc );
 
     if( eLang != pLclData->getLanguageTag().getLanguageType() ||
@@ -296,13 +274,6 @@ SwCalc::SwCalc( SwDoc& rD )
         // those have two HashIds
         sNType25, sNType26
     };
-    static sal_uInt16 const aHashValue[ 27 ] =
-    {
-        34, 38, 43,  7, 18, 32, 22, 29, 30, 33,  3,
-        28, 24, 40,  9, 11, 26, 45,  4, 23, 36, 44, 19,  5,  1,
-        // those have two HashIds
-        11, 38
-    };
     static UserOptToken const aAdrToken[ 12 ] =
     {
         UserOptToken::Company, UserOptToken::Street, UserOptToken::Country, UserOptToken::Zip,
@@ -320,53 +291,48 @@ SwCalc::SwCalc( SwDoc& rD )
         &SwDocStat::nWord, &SwDocStat::nChar
     };
 
-#if TBLSZ != 47
-#error Did you adjust all hash values?
-#endif
-
     const SwDocStat& rDocStat = rDoc.getIDocumentStatistics().GetDocStat();
 
     SwSbxValue nVal;
     OUString sTmpStr;
     sal_uInt16 n;
 
+    SwCalcExp* aExp[ 25 ];
     for( n = 0; n < 25; ++n )
     {
         sTmpStr = OUString::createFromAscii(sNTypeTab[n]);
-        VarTable[ aHashValue[ n ] ] = new SwCalcExp( sTmpStr, nVal, 0 );
+        aExp[ n ] = new SwCalcExp( sTmpStr, nVal, 0 );
+        VarTable.Insert( aExp[ n ] );
     }
 
-    static_cast<SwCalcExp*>(VarTable[ aHashValue[ 0 ] ])->nValue.PutBool( false );
-    static_cast<SwCalcExp*>(VarTable[ aHashValue[ 1 ] ])->nValue.PutBool( true );
-    static_cast<SwCalcExp*>(VarTable[ aHashValue[ 2 ] ])->nValue.PutDouble( F_PI );
-    static_cast<SwCalcExp*>(VarTable[ aHashValue[ 3 ] ])->nValue.PutDouble( 2.7182818284590452354 );
+    aExp[ 0 ]->nValue.PutBool( false );
+    aExp[ 1 ]->nValue.PutBool( true );
+    aExp[ 2 ]->nValue.PutDouble( F_PI );
+    aExp[ 3 ]->nValue.PutDouble( 2.7182818284590452354 );
 
     for( n = 0; n < 3; ++n )
-        static_cast<SwCalcExp*>(VarTable[ aHashValue[ n + 4 ] ])->nValue.PutLong( rDocStat.*aDocStat1[ n ]  );
+        aExp[ n + 4 ]->nValue.PutLong( rDocStat.*aDocStat1[ n ]  );
     for( n = 0; n < 4; ++n )
-        static_cast<SwCalcExp*>(VarTable[ aHashValue[ n + 7 ] ])->nValue.PutLong( rDocStat.*aDocStat2[ n ]  );
+        aExp[ n + 7 ]->nValue.PutLong( rDocStat.*aDocStat2[ n ]  );
 
     SvtUserOptions& rUserOptions = SW_MOD()->GetUserOptions();
 
-    static_cast<SwCalcExp*>(VarTable[ aHashValue[ 11 ] ])->nValue.PutString( rUserOptions.GetFirstName() );
-    static_cast<SwCalcExp*>(VarTable[ aHashValue[ 12 ] ])->nValue.PutString( rUserOptions.GetLastName() );
-    static_cast<SwCalcExp*>(VarTable[ aHashValue[ 13 ] ])->nValue.PutString( rUserOptions.GetID() );
+    aExp[ 11 ]->nValue.PutString( rUserOptions.GetFirstName() );
+    aExp[ 12 ]->nValue.PutString( rUserOptions.GetLastName() );
+    aExp[ 13 ]->nValue.PutString( rUserOptions.GetID() );
 
     for( n = 0; n < 11; ++n )
-        static_cast<SwCalcExp*>(VarTable[ aHashValue[ n + 14 ] ])->nValue.PutString(
+        aExp[ n + 14 ]->nValue.PutString(
                                         rUserOptions.GetToken( aAdrToken[ n ] ));
 
     nVal.PutString( rUserOptions.GetToken( aAdrToken[ 11 ] ));
     sTmpStr = OUString::createFromAscii(sNTypeTab[25]);
-    VarTable[ aHashValue[ 25 ] ]->pNext = new SwCalcExp( sTmpStr, nVal, 0 );
+    VarTable.Insert( new SwCalcExp( sTmpStr, nVal, 0 ) );
 
 } // SwCalc::SwCalc
 
 SwCalc::~SwCalc()
 {
-    for( sal_uInt16 n = 0; n < TBLSZ; ++n )
-        delete VarTable[n];
-
     if( pLclData != m_aSysLocale.GetLocaleDataPtr() )
         delete pLclData;
     if( pCharClass != &GetAppCharClass() )
@@ -381,6 +347,11 @@ SwSbxValue SwCalc::Calculate( const OUString& rStr )
     if( rStr.isEmpty() )
         return nResult;
 
+    m_pFormula = 0;
+    const SwCalcFormula* pFormula = Compile( rStr );
+    m_pFormula = pFormula->bValid ? pFormula : 0;
+    m_nTokenPos = 0;
+
     nListPor = 0;
     eCurrListOper = CALC_PLUS; // default: sum
 
@@ -396,6 +367,48 @@ SwSbxValue SwCalc::Calculate( const OUString& rStr )
     return nResult;
 }
 
+/** Split the formula into tokens, or look them up if that happened before.
+
+    The tokens only depend on the formula and the calculator's locale, so
+    formulas that are evaluated again (e.g. the same expression in many
+    fields) skip the tokenizer.
+*/
+const SwCalcFormula* SwCalc::Compile( const OUString& rStr )
+{
+    std::unordered_map<OUString, SwCalcFormula, OUStringHash>::const_iterator it
+        = m_aFormulas.find( rStr );
+    if( it != m_aFormulas.end() )
+        return &it->second;
+
+    // table formulas contain the cell values, so keep the cache bounded;
+    // while a user field is calculated an outer formula is still replayed
+    if( m_aFormulas.size() >= 1024 && aRekurStk.empty() )
+        m_aFormulas.clear();
+
+    SwCalcFormula& rFormula = m_aFormulas[ rStr ];
+
+    eCurrListOper = CALC_PLUS;
+    sCommand = rStr;
+    nCommandPos = 0;
+    while( GetToken() != CALC_ENDCALC && eError == CALC_NOERR )
+    {
+        rFormula.aTokens.push_back( SwCalcToken( eCurrOper, eCurrListOper ) );
+        SwCalcToken& rToken = rFormula.aTokens.back();
+        if( CALC_NUMBER == eCurrOper )
+            rToken.aNumber = nNumberValue;
+        else if( CALC_NAME == eCurrOper )
+            rToken.aName = aVarName;
+    }
+
+    // let the interpreter report the error at the right place
+    rFormula.bValid = eError == CALC_NOERR;
+    if( !rFormula.bValid )
+        rFormula.aTokens.clear();
+    eError = CALC_NOERR;
+
+    return &rFormula;
+}
+
 //TODO: provide documentation
 /** ???
 
@@ -450,26 +463,22 @@ SwCalcExp* SwCalc::VarLook( const OUString& rStr, bool bIns )
 {
     aErrExpr.nValue.SetVoidValue(false);
 
-    sal_uInt16 ii = 0;
     OUString aStr = pCharClass->lowercase( rStr );
+    const sal_uInt32 nHash = SwHashTable::HashValue( aStr );
 
-    SwHash* pFnd = Find( aStr, VarTable, TBLSZ, &ii );
+    SwHash* pFnd = VarTable.Find( aStr, nHash );
 
     if( !pFnd )
     {
         // then check doc
-        SwHash* const * ppDocTable = rDoc.getIDocumentFieldsAccess().GetUpdateFields().GetFieldTypeTable();
-        for( SwHash* pEntry = *(ppDocTable+ii); pEntry; pEntry = pEntry->pNext )
+        const SwHashTable& rDocTable = rDoc.getIDocumentFieldsAccess().GetUpdateFields().GetFieldTypeTable();
+        SwHash* pEntry = rDocTable.Find( aStr, nHash );
+        if( pEntry )
         {
-            if( aStr == pEntry->aStr )
-            {
-                // then insert here
-                pFnd = new SwCalcExp( aStr, SwSbxValue(),
-                                    static_cast<SwCalcFieldType*>(pEntry)->pFieldType );
-                pFnd->pNext = *(VarTable+ii);
-                *(VarTable+ii) = pFnd;
-                break;
-            }
+            // then insert here
+            pFnd = new SwCalcExp( aStr, SwSbxValue(),
+                                static_cast<SwCalcFieldType*>(pEntry)->pFieldType );
+            VarTable.Insert( pFnd );
         }
     }
 
@@ -490,7 +499,10 @@ SwCalcExp* SwCalc::VarLook( const OUString& rStr, bool bIns )
                 sal_uInt16          nOld_ListPor        = nListPor;
                 SwSbxValue      nOld_LastLeft       = nLastLeft;
                 SwSbxValue      nOld_NumberValue    = nNumberValue;
+                OUString        sOld_Command        = sCommand;
                 sal_Int32      nOld_CommandPos     = nCommandPos;
+                const SwCalcFormula* pOld_Formula   = m_pFormula;
+                size_t          nOld_TokenPos       = m_nTokenPos;
                 SwCalcOper      eOld_CurrOper       = eCurrOper;
                 SwCalcOper      eOld_CurrListOper   = eCurrListOper;
 
@@ -500,7 +512,10 @@ SwCalcExp* SwCalc::VarLook( const OUString& rStr, bool bIns )
                 nListPor        = nOld_ListPor;
                 nLastLeft       = nOld_LastLeft;
                 nNumberValue    = nOld_NumberValue;
+                sCommand        = sOld_Command;
                 nCommandPos     = nOld_CommandPos;
+                m_pFormula      = pOld_Formula;
+                m_nTokenPos     = nOld_TokenPos;
                 eCurrOper       = eOld_CurrOper;
                 eCurrListOper   = eOld_CurrListOper;
             }
@@ -544,7 +559,7 @@ SwCalcExp* SwCalc::VarLook( const OUString& rStr, bool bIns )
             }
 
             sal_uLong nTmpRec = 0;
-            if( 0 != ( pFnd = Find( sDBNum, VarTable, TBLSZ ) ) )
+            if( 0 != ( pFnd = VarTable.Find( sDBNum ) ) )
                 nTmpRec = static_cast<SwCalcExp*>(pFnd)->nValue.GetULong();
 
             OUString sResult;
@@ -573,8 +588,7 @@ SwCalcExp* SwCalc::VarLook( const OUString& rStr, bool bIns )
     }
 
     SwCalcExp* pNewExp = new SwCalcExp( aStr, SwSbxValue(), 0 );
-    pNewExp->pNext = VarTable[ ii ];
-    VarTable[ ii ] = pNewExp;
+    VarTable.Insert( pNewExp );
 
     OUString sColumnName( GetColumnName( sTmpName ));
     OSL_ENSURE( !sColumnName.isEmpty(), "Missing DB column name" );
@@ -612,14 +626,12 @@ void SwCalc::VarChange( const OUString& rStr, const SwSbxValue& rValue )
 {
     OUString aStr = pCharClass->lowercase( rStr );
 
-    sal_uInt16 nPos = 0;
-    SwCalcExp* pFnd = static_cast<SwCalcExp*>(Find( aStr, VarTable, TBLSZ, &nPos ));
+    SwCalcExp* pFnd = static_cast<SwCalcExp*>(VarTable.Find( aStr ));
 
     if( !pFnd )
     {
         pFnd = new SwCalcExp( aStr, SwSbxValue( rValue ), 0 );
-        pFnd->pNext = VarTable[ nPos ];
-        VarTable[ nPos ] = pFnd;
+        VarTable.Insert( pFnd );
     }
     else
     {
@@ -645,6 +657,20 @@ void SwCalc::Pop()
 
 SwCalcOper SwCalc::GetToken()
 {
+    if( m_pFormula )
+    {
+        if( m_nTokenPos >= m_pFormula->aTokens.size() )
+            return eCurrOper = CALC_ENDCALC;
+
+        const SwCalcToken& rToken = m_pFormula->aTokens[ m_nTokenPos++ ];
+        eCurrListOper = rToken.eListOper;
+        if( CALC_NUMBER == rToken.eOper )
+            nNumberValue = rToken.aNumber;
+        else if( CALC_NAME == rToken.eOper )
+            aVarName = rToken.aName;
+        return eCurrOper = rToken.eOper;
+    }
+
 #if OSL_DEBUG_LEVEL > 1
     // static for switch back to the "old" implementation of the calculator
     // which doesn't use the I18N routines.
@@ -1569,6 +1595,7 @@ bool SwCalc::IsValidVarName( const OUString& rStr, OUString* pValidName )
 
 SwHash::SwHash(const OUString& rStr)
     : aStr(rStr)
+    , nHash(SwHashTable::HashValue(rStr))
     , pNext(0)
 {
 }
@@ -1578,11 +1605,93 @@ SwHash::~SwHash()
     delete pNext;
 }
 
-void DeleteHashTable( SwHash **ppHashTable, sal_uInt16 nCount )
+SwHashTable::SwHashTable( size_t nSize )
+    : m_aBuckets( nSize ? nSize : 1, static_cast<SwHash*>(0) )
+    , m_nCount( 0 )
+{
+}
+
+SwHashTable::~SwHashTable()
+{
+    Clear();
+}
+
+SwHash* SwHashTable::Find( const OUString& rStr, sal_uInt32 nHash ) const
+{
+    for( SwHash* pEntry = m_aBuckets[ nHash % m_aBuckets.size() ];
+         pEntry; pEntry = pEntry->pNext )
+    {
+        if( nHash == pEntry->nHash && rStr == pEntry->aStr )
+            return pEntry;
+    }
+    return 0;
+}
+
+void SwHashTable::Insert( SwHash* pNew )
+{
+    OSL_ENSURE( !Find( pNew->aStr, pNew->nHash ), "entry already in hash table" );
+    // keep the load factor below 1, the chains are walked on every lookup
+    if( m_nCount >= m_aBuckets.size() )
+        Rehash( 2 * m_aBuckets.size() + 1 );
+
+    SwHash*& rBucket = m_aBuckets[ pNew->nHash % m_aBuckets.size() ];
+    pNew->pNext = rBucket;
+    rBucket = pNew;
+    ++m_nCount;
+}
+
+SwHash* SwHashTable::Remove( const OUString& rStr )
+{
+    const sal_uInt32 nHash = HashValue( rStr );
+    for( SwHash** ppEntry = &m_aBuckets[ nHash % m_aBuckets.size() ];
+         *ppEntry; ppEntry = &(*ppEntry)->pNext )
+    {
+        SwHash* pEntry = *ppEntry;
+        if( nHash == pEntry->nHash && rStr == pEntry->aStr )
+        {
+            *ppEntry = pEntry->pNext;
+            pEntry->pNext = 0;
+            --m_nCount;
+            return pEntry;
+        }
+    }
+    return 0;
+}
+
+void SwHashTable::Clear()
 {
-    for ( sal_uInt16 i = 0; i < nCount; ++i )
-        delete *(ppHashTable+i);
-    delete [] ppHashTable;
+    for( size_t n = 0; n < m_aBuckets.size(); ++n )
+    {
+        // unlink before deleting, ~SwHash would otherwise recurse down the chain
+        SwHash* pEntry = m_aBuckets[ n ];
+        while( pEntry )
+        {
+            SwHash* pNext = pEntry->pNext;
+            pEntry->pNext = 0;
+            delete pEntry;
+            pEntry = pNext;
+        }
+        m_aBuckets[ n ] = 0;
+    }
+    m_nCount = 0;
+}
+
+void SwHashTable::Rehash( size_t nNewSize )
+{
+    std::vector<SwHash*> aNew( nNewSize, static_cast<SwHash*>(0) );
+    for( size_t n = 0; n < m_aBuckets.size(); ++n )
+    {
+        SwHash* pEntry = m_aBuckets[ n ];
+        while( pEntry )
+        {
+            SwHash* pNext = pEntry->pNext;
+            SwHash*& rBucket = aNew[ pEntry->nHash % nNewSize ];
+            pEntry->pNext = rBucket;
+            rBucket = pEntry;
+            pEntry = pNext;
+        }
+    }
+    m_aBuckets.swap( aNew );
 }
 
 SwCalcExp::SwCalcExp(const OUString& rStr, const SwSbxValue& rVal,
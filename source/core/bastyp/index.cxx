@@ -65,9 +65,10 @@ void SwIndex::Init(sal_Int32 const nIdx)
         m_pIndexReg->m_pFirst = m_pIndexReg->m_pLast = this;
         m_nIndex = nIdx;
     }
-    else if (nIdx > ((m_pIndexReg->m_pLast->m_nIndex
-                        - m_pIndexReg->m_pFirst->m_nIndex) / 2))
+    else if (nIdx - m_pIndexReg->m_pFirst->m_nIndex
+                > m_pIndexReg->m_pLast->m_nIndex - nIdx)
     {
+        // closer to the end: search from there
         ChgValue( *m_pIndexReg->m_pLast, nIdx );
     }
     else
@@ -236,12 +237,8 @@ void SwIndexReg::Update(
     const sal_Int32 nNewVal = rIdx.m_nIndex;
     if( bNeg )
     {
+        // indexes in front of rIdx are not affected by a deletion
         const sal_Int32 nLast = rIdx.GetIndex() + nDiff;
-        while (pStt && pStt->m_nIndex == nNewVal)
-        {
-            pStt->m_nIndex = nNewVal;
-            pStt = pStt->m_pPrev;
-        }
         pStt = rIdx.m_pNext;
         while (pStt && pStt->m_nIndex >= nNewVal
                     && pStt->m_nIndex <= nLast)
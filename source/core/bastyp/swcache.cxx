@@ -22,6 +22,7 @@
 #include <rtl/strbuf.hxx>
 #include <osl/diagnose.h>
 
+#include <algorithm>
 #include <limits.h>
 
 #ifdef DBG_UTIL
@@ -54,6 +55,7 @@ void SwCache::Check()
         SAL_WARN_IF(pObj == pOldRealFirst, "sw.core", "Recursion in SwCache.");
     }
     SAL_WARN_IF( !bFirstFound, "sw.core", "First not Found." );
+    SAL_WARN_IF( m_aOwners.size() > nCnt, "sw.core", "Owner map out of sync." );
     SAL_WARN_IF( nCnt + aFreePositions.size() != size(), "sw.core", "Lost Chain." );
     SAL_WARN_IF(
         size() == nCurMax && nCurMax != aFreePositions.size() + nCnt, "sw.core",
@@ -77,7 +79,8 @@ SwCache::SwCache( const sal_uInt16 nInitSize
     pRealFirst( 0 ),
     pFirst( 0 ),
     pLast( 0 ),
-    nCurMax( nInitSize )
+    nCurMax( nInitSize ),
+    nGrowLimit( 0 )
 #ifdef DBG_UTIL
     , m_aName( rNm )
     , m_nAppend( 0 )
@@ -88,11 +91,11 @@ SwCache::SwCache( const sal_uInt16 nInitSize
     , m_nToTop( 0 )
     , m_nDelete( 0 )
     , m_nGetSeek( 0 )
-    , m_nAverageSeekCnt( 0 )
     , m_nFlushCnt( 0 )
     , m_nFlushedObjects( 0 )
     , m_nIncreaseMax( 0 )
     , m_nDecreaseMax( 0 )
+    , m_nAutoGrow( 0 )
 #endif
 {
     m_aCacheObjects.reserve( nInitSize );
@@ -111,11 +114,11 @@ SwCache::~SwCache()
             << "; number or reordering (LRU): " << m_nToTop
             << "; number of suppressions: " << m_nDelete
             << "; number of Get's without Index: " << m_nGetSeek
-            << "; number of Seek for Get without Index: " << m_nAverageSeekCnt
             << "; number of Flush calls: " << m_nFlushCnt
             << "; number of flushed objects: " << m_nFlushedObjects
             << "; number of Cache expansions: " << m_nIncreaseMax
-            << "; number of Cache reductions: " << m_nDecreaseMax);
+            << "; number of Cache reductions: " << m_nDecreaseMax
+            << "; number of automatic Cache expansions: " << m_nAutoGrow);
     Check();
 #endif
 
@@ -156,6 +159,7 @@ void SwCache::Flush( const sal_uInt8 )
         {
             pTmp = pObj;
             pObj = pTmp->GetNext();
+            RemoveOwner( pTmp );
             aFreePositions.push_back( pTmp->GetCachePos() );
             m_aCacheObjects[pTmp->GetCachePos()] = NULL;
             delete pTmp;
@@ -234,8 +238,12 @@ SwCacheObj *SwCache::Get( const void *pOwner, const sal_uInt16 nIndex,
     {
         if ( !pRet->IsOwner( pOwner ) )
             pRet = 0;
-        else if ( bToTop && pRet != pFirst )
-            ToTop( pRet );
+        else if ( bToTop )
+        {
+            pRet->bUsed = true;
+            if ( pRet != pFirst )
+                ToTop( pRet );
+        }
     }
 
 #ifdef DBG_UTIL
@@ -250,16 +258,18 @@ SwCacheObj *SwCache::Get( const void *pOwner, const sal_uInt16 nIndex,
 
 SwCacheObj *SwCache::Get( const void *pOwner, const bool bToTop )
 {
-    SwCacheObj *pRet = pRealFirst;
-    while ( pRet && !pRet->IsOwner( pOwner ) )
+    SwCacheObj *pRet = 0;
+    const SwCacheOwnerMap::const_iterator aIt = m_aOwners.find( pOwner );
+    if ( aIt != m_aOwners.end() && aIt->second->IsOwner( pOwner ) )
+        pRet = aIt->second;
+
+    if ( bToTop && pRet )
     {
-        INCREMENT( m_nAverageSeekCnt );
-        pRet = pRet->GetNext();
+        pRet->bUsed = true;
+        if ( pRet != pFirst )
+            ToTop( pRet );
     }
 
-    if ( bToTop && pRet && pRet != pFirst )
-        ToTop( pRet );
-
 #ifdef DBG_UTIL
     if ( pRet )
         ++m_nGetSuccess;
@@ -293,6 +303,7 @@ void SwCache::DeleteObj( SwCacheObj *pObj )
     if ( pObj->GetNext() )
         pObj->GetNext()->SetPrev( pObj->GetPrev() );
 
+    RemoveOwner( pObj );
     aFreePositions.push_back( pObj->GetCachePos() );
     m_aCacheObjects[pObj->GetCachePos()] = NULL;
     delete pObj;
@@ -321,6 +332,14 @@ void SwCache::DeleteObj( SwCacheObj *pObj )
     CHECK;
 }
 
+void SwCache::RemoveOwner( SwCacheObj *pObj )
+{
+    // only forget the owner if it was not taken over by a newer object
+    const SwCacheOwnerMap::iterator aIt = m_aOwners.find( pObj->GetOwner() );
+    if ( aIt != m_aOwners.end() && aIt->second == pObj )
+        m_aOwners.erase( aIt );
+}
+
 void SwCache::Delete( const void *pOwner )
 {
     INCREMENT( m_nDelete );
@@ -334,6 +353,31 @@ bool SwCache::Insert( SwCacheObj *pNew )
     CHECK;
     OSL_ENSURE( !pNew->GetPrev() && !pNew->GetNext(), "New but not new." );
 
+    if ( m_aCacheObjects.size() >= nCurMax && aFreePositions.empty() &&
+         nCurMax < nGrowLimit )
+    {
+        // Second chance: an object at the end of the LRU chain which was
+        // accessed again since it was inserted (or passed over the last
+        // time) goes to the top once more, with the mark cleared. If a
+        // quarter of the cache is passed over like that, the working set
+        // does not fit, so rather grow than start thrashing.
+        const sal_uInt16 nStep = std::max<sal_uInt16>( nCurMax / 4, 1 );
+        sal_uInt16 nPassed = 0;
+        while ( nPassed < nStep && pLast && pLast != pFirst &&
+                pLast->bUsed && !pLast->IsLocked() )
+        {
+            SwCacheObj *pObj = pLast;
+            pObj->bUsed = false;
+            ToTop( pObj );
+            ++nPassed;
+        }
+        if ( nPassed == nStep )
+        {
+            INCREMENT( m_nAutoGrow );
+            nCurMax = std::min<sal_uInt16>( nCurMax + nStep, nGrowLimit );
+        }
+    }
+
     sal_uInt16 nPos;
     if ( m_aCacheObjects.size() < nCurMax )
     {
@@ -378,10 +422,13 @@ bool SwCache::Insert( SwCacheObj *pNew )
             if ( pObj->GetNext() )
                 pObj->GetNext()->SetPrev( pObj->GetPrev() );
         }
+        RemoveOwner( pObj );
         delete pObj;
         m_aCacheObjects[nPos] = pNew;
     }
     pNew->SetCachePos( nPos );
+    if ( pNew->GetOwner() )
+        m_aOwners[ pNew->GetOwner() ] = pNew;
 
     if ( pFirst )
     {
@@ -426,6 +473,7 @@ SwCacheObj::SwCacheObj( const void *pOwn ) :
     pPrev( 0 ),
     nCachePos( USHRT_MAX ),
     nLock( 0 ),
+    bUsed( false ),
     pOwner( pOwn )
 {
 }
@@ -1325,6 +1325,8 @@ void SwCrsrShell::UpdateCrsrPos()
     if( pGrammarContact )
         pGrammarContact->updateCursorPosition( *m_pCurCrsr->GetPoint() );
     --mnStartAction;
+    if( !mnStartAction )
+        Imp()->FlushInvalidRects();
     if( aOldSz != GetDocSize() )
         SizeChgNotify();
 }
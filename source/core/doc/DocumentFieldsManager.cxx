@@ -137,6 +137,23 @@ namespace
     #endif
         }
     }
+
+    /// Set the string saved under rName in the hash table, insert it if needed
+    _HashStr* lcl_SetHashStr( SwHashTable& rTable, const OUString& rName,
+                              const OUString& rValue )
+    {
+        _HashStr* pFnd = static_cast<_HashStr*>(rTable.Find( rName ));
+        if( pFnd )
+            // modify entry in the hash table
+            pFnd->aSetStr = rValue;
+        else
+        {
+            // insert the new entry
+            pFnd = new _HashStr( rName, rValue );
+            rTable.Insert( pFnd );
+        }
+        return pFnd;
+    }
 }
 
 namespace sw
@@ -852,11 +869,7 @@ void DocumentFieldsManager::UpdateExpFields( SwTextField* pUpdateField, bool bUp
 
     // Hash table for all string replacements is filled on-the-fly.
     // Try to fabricate an uneven number.
-    const SwFieldTypes::size_type nHashSize {(( mpFieldTypes->size() / 7 ) + 1 ) * 7};
-    const sal_uInt16 nStrFormatCnt = static_cast<sal_uInt16>(nHashSize);
-    OSL_ENSURE( nStrFormatCnt == nHashSize, "Downcasting to sal_uInt16 lost information!" );
-    SwHash** pHashStrTable = new SwHash*[ nStrFormatCnt ];
-    memset( pHashStrTable, 0, sizeof( _HashStr* ) * nStrFormatCnt );
+    SwHashTable aHashStrTable( (( mpFieldTypes->size() / 7 ) + 1 ) * 7 );
 
     {
         const SwFieldType* pFieldType;
@@ -866,18 +879,9 @@ void DocumentFieldsManager::UpdateExpFields( SwTextField* pUpdateField, bool bUp
             {
             case RES_USERFLD:
                 {
-                    // Entry present?
-                    sal_uInt16 nPos;
                     const OUString& rNm = pFieldType->GetName();
                     OUString sExpand(const_cast<SwUserFieldType*>(static_cast<const SwUserFieldType*>(pFieldType))->Expand(nsSwGetSetExpType::GSE_STRING, 0, 0));
-                    SwHash* pFnd = Find( rNm, pHashStrTable, nStrFormatCnt, &nPos );
-                    if( pFnd )
-                        // modify entry in the hash table
-                        static_cast<_HashStr*>(pFnd)->aSetStr = sExpand;
-                    else
-                        // insert the new entry
-                        *(pHashStrTable + nPos ) = new _HashStr( rNm, sExpand,
-                                                static_cast<_HashStr*>(*(pHashStrTable + nPos)) );
+                    lcl_SetHashStr( aHashStrTable, rNm, sExpand );
                 }
                 break;
             case RES_SETEXPFLD:
@@ -1013,21 +1017,8 @@ void DocumentFieldsManager::UpdateExpFields( SwTextField* pUpdateField, bool bUp
             const OUString& rName = pField->GetTyp()->GetName();
 
             // Add entry to hash table
-            // Entry present?
-            sal_uInt16 nPos;
-            SwHash* pFnd = Find( rName, pHashStrTable, nStrFormatCnt, &nPos );
             OUString const value(pField->ExpandField(m_rDoc.IsClipBoard()));
-            if( pFnd )
-            {
-                // Modify entry in the hash table
-                static_cast<_HashStr*>(pFnd)->aSetStr = value;
-            }
-            else
-            {
-                // insert new entry
-                *(pHashStrTable + nPos ) = new _HashStr( rName,
-                    value, static_cast<_HashStr *>(*(pHashStrTable + nPos)));
-            }
+            lcl_SetHashStr( aHashStrTable, rName, value );
 #endif
         }
         break;
@@ -1043,8 +1034,7 @@ void DocumentFieldsManager::UpdateExpFields( SwTextField* pUpdateField, bool bUp
                     if( (!pUpdateField || pUpdateField == pTextField )
                         && pGField->IsInBodyText() )
                     {
-                        aNew = LookString( pHashStrTable, nStrFormatCnt,
-                                    pGField->GetFormula() );
+                        aNew = LookString( aHashStrTable, pGField->GetFormula() );
                         pGField->ChgExpStr( aNew );
                     }
                 }
@@ -1052,8 +1042,7 @@ void DocumentFieldsManager::UpdateExpFields( SwTextField* pUpdateField, bool bUp
                 {
                     SwSetExpField* pSField = const_cast<SwSetExpField*>(static_cast<const SwSetExpField*>(pField));
                     // is the "formula" a field?
-                    aNew = LookString( pHashStrTable, nStrFormatCnt,
-                                pSField->GetFormula() );
+                    aNew = LookString( aHashStrTable, pSField->GetFormula() );
 
                     if( aNew.isEmpty() )               // nothing found then the formula is the new value
                         aNew = pSField->GetFormula();
@@ -1064,21 +1053,12 @@ void DocumentFieldsManager::UpdateExpFields( SwTextField* pUpdateField, bool bUp
 
                     // lookup the field's name
                     aNew = static_cast<SwSetExpFieldType*>(pSField->GetTyp())->GetSetRefName();
-                    // Entry present?
-                    sal_uInt16 nPos;
-                    SwHash* pFnd = Find( aNew, pHashStrTable, nStrFormatCnt, &nPos );
-                    if( pFnd )
-                        // Modify entry in the hash table
-                        static_cast<_HashStr*>(pFnd)->aSetStr = pSField->GetExpStr();
-                    else
-                        // insert new entry
-                        *(pHashStrTable + nPos ) = pFnd = new _HashStr( aNew,
-                                        pSField->GetExpStr(),
-                                        static_cast<_HashStr*>(*(pHashStrTable + nPos) ));
+                    _HashStr* pFnd = lcl_SetHashStr( aHashStrTable, aNew,
+                                                     pSField->GetExpStr() );
 
                     // Extension for calculation with Strings
                     SwSbxValue aValue;
-                    aValue.PutString( static_cast<_HashStr*>(pFnd)->aSetStr );
+                    aValue.PutString( pFnd->aSetStr );
                     aCalc.VarChange( aNew, aValue );
                 }
             }
@@ -1141,7 +1121,15 @@ void DocumentFieldsManager::UpdateExpFields( SwTextField* pUpdateField, bool bUp
         }
         } // switch
 
-        pFormatField->ModifyNotification( 0, 0 );        // trigger formatting
+        if( RES_GETEXPFLD == nWhich || RES_SETEXPFLD == nWhich )
+        {
+            // Most variables keep their value; only trigger formatting for
+            // the fields whose expansion really changed. The field that was
+            // asked for explicitly is always notified.
+            pTextField->ExpandTextField( pUpdateField == pTextField );
+        }
+        else
+            pFormatField->ModifyNotification( 0, 0 );        // trigger formatting
 
         if( pUpdateField == pTextField )       // if only &m_rDoc one is updated
         {
@@ -1156,8 +1144,6 @@ void DocumentFieldsManager::UpdateExpFields( SwTextField* pUpdateField, bool bUp
 #if HAVE_FEATURE_DBCONNECTIVITY
     pMgr->CloseAll(false);
 #endif
-    // delete hash table
-    ::DeleteHashTable( pHashStrTable, nStrFormatCnt );
 
     // update reference fields
     if( bUpdRefFields )
@@ -1434,18 +1420,17 @@ void DocumentFieldsManager::FieldsToCalc( SwCalc& rCalc, sal_uLong nLastNd, sal_
 #endif
 }
 
-void DocumentFieldsManager::FieldsToExpand( SwHash**& ppHashTable, sal_uInt16& rTableSize,
+void DocumentFieldsManager::FieldsToExpand( SwHashTable& rHashTable,
                             const _SetGetExpField& rToThisField )
 {
     // create the sorted list of all SetFields
     mpUpdateFields->MakeFieldList( m_rDoc, mbNewFieldLst, GETFLD_EXPAND );
     mbNewFieldLst = false;
 
-    // Hash table for all string replacements is filled on-the-fly.
-    // Try to fabricate an uneven number.
-    rTableSize = (( mpUpdateFields->GetSortLst()->size() / 7 ) + 1 ) * 7;
-    ppHashTable = new SwHash*[ rTableSize ];
-    memset( ppHashTable, 0, sizeof( _HashStr* ) * rTableSize );
+    // Hash table for all string replacements is filled on-the-fly. Clear()
+    // keeps the buckets, so a table that outlives the call (like the one of
+    // SwDocUpdateField::GetExpandTable()) is not reallocated each time.
+    rHashTable.Clear();
 
     _SetGetExpFields::const_iterator const itLast =
         mpUpdateFields->GetSortLst()->upper_bound(
@@ -1466,7 +1451,7 @@ void DocumentFieldsManager::FieldsToExpand( SwHash**& ppHashTable, sal_uInt16& r
                 // set the new value in the hash table
                 // is the formula a field?
                 SwSetExpField* pSField = const_cast<SwSetExpField*>(static_cast<const SwSetExpField*>(pField));
-                OUString aNew = LookString( ppHashTable, rTableSize, pSField->GetFormula() );
+                OUString aNew = LookString( rHashTable, pSField->GetFormula() );
 
                 if( aNew.isEmpty() )               // nothing found, then the formula is
                     aNew = pSField->GetFormula(); // the new value
@@ -1477,16 +1462,7 @@ void DocumentFieldsManager::FieldsToExpand( SwHash**& ppHashTable, sal_uInt16& r
 
                 // look up the field's name
                 aNew = static_cast<SwSetExpFieldType*>(pSField->GetTyp())->GetSetRefName();
-                // Entry present?
-                sal_uInt16 nPos;
-                SwHash* pFnd = Find( aNew, ppHashTable, rTableSize, &nPos );
-                if( pFnd )
-                    // modify entry in the hash table
-                    static_cast<_HashStr*>(pFnd)->aSetStr = pSField->GetExpStr();
-                else
-                    // insert the new entry
-                    *(ppHashTable + nPos ) = new _HashStr( aNew,
-                            pSField->GetExpStr(), static_cast<_HashStr*>(*(ppHashTable + nPos)) );
+                lcl_SetHashStr( rHashTable, aNew, pSField->GetExpStr() );
             }
             break;
         case RES_DBFLD:
@@ -1494,21 +1470,8 @@ void DocumentFieldsManager::FieldsToExpand( SwHash**& ppHashTable, sal_uInt16& r
                 const OUString& rName = pField->GetTyp()->GetName();
 
                 // Insert entry in the hash table
-                // Entry present?
-                sal_uInt16 nPos;
-                SwHash* pFnd = Find( rName, ppHashTable, rTableSize, &nPos );
                 OUString const value(pField->ExpandField(m_rDoc.IsClipBoard()));
-                if( pFnd )
-                {
-                    // modify entry in the hash table
-                    static_cast<_HashStr*>(pFnd)->aSetStr = value;
-                }
-                else
-                {
-                    // insert the new entry
-                    *(ppHashTable + nPos ) = new _HashStr( rName,
-                        value, static_cast<_HashStr *>(*(ppHashTable + nPos)));
-                }
+                lcl_SetHashStr( rHashTable, rName, value );
             }
             break;
         }
@@ -72,10 +72,10 @@ using namespace com::sun::star;
             const SwRedlineTable& rTable = redlineAccess.GetRedlineTable();
 
             // verify valid redline positions
-            for( sal_uInt16 i = 0; i < rTable.size(); ++i )
+            for( SwRedlineTable::size_type i = 0; i < rTable.size(); ++i )
                 lcl_CheckPam( rTable[ i ] );
 
-            for( sal_uInt16 j = 0; j < rTable.size(); ++j )
+            for( SwRedlineTable::size_type j = 0; j < rTable.size(); ++j )
             {
                 // check for empty redlines
                 OSL_ENSURE( ( *(rTable[j]->GetPoint()) != *(rTable[j]->GetMark()) ) ||
@@ -84,7 +84,7 @@ using namespace com::sun::star;
              }
 
             // verify proper redline sorting
-            for( sal_uInt16 n = 1; n < rTable.size(); ++n )
+            for( SwRedlineTable::size_type n = 1; n < rTable.size(); ++n )
             {
                 const SwRangeRedline* pPrev = rTable[ n-1 ];
                 const SwRangeRedline* pCurrent = rTable[ n ];
@@ -121,7 +121,7 @@ namespace
                rPos1.nContent.GetIndex() == pCNd->Len();
     }
 
-    static bool lcl_AcceptRedline( SwRedlineTable& rArr, sal_uInt16& rPos,
+    static bool lcl_AcceptRedline( SwRedlineTable& rArr, SwRedlineTable::size_type& rPos,
                             bool bCallDelete,
                             const SwPosition* pSttRng = 0,
                             const SwPosition* pEndRng = 0 )
@@ -280,7 +280,7 @@ namespace
         return bRet;
     }
 
-    static bool lcl_RejectRedline( SwRedlineTable& rArr, sal_uInt16& rPos,
+    static bool lcl_RejectRedline( SwRedlineTable& rArr, SwRedlineTable::size_type& rPos,
                             bool bCallDelete,
                             const SwPosition* pSttRng = 0,
                             const SwPosition* pEndRng = 0 )
@@ -484,7 +484,7 @@ namespace
         return bRet;
     }
 
-    typedef bool (*Fn_AcceptReject)( SwRedlineTable& rArr, sal_uInt16& rPos,
+    typedef bool (*Fn_AcceptReject)( SwRedlineTable& rArr, SwRedlineTable::size_type& rPos,
                             bool bCallDelete,
                             const SwPosition* pSttRng,
                             const SwPosition* pEndRng);
@@ -494,7 +494,7 @@ namespace
                                 SwRedlineTable& rArr, bool bCallDelete,
                                 const SwPaM& rPam)
     {
-        sal_uInt16 n = 0;
+        SwRedlineTable::size_type n = 0;
         int nCount = 0;
 
         const SwPosition* pStt = rPam.Start(),
@@ -570,6 +570,22 @@ namespace
             }
         }
     }
+
+    /// The end of the text section rNd is in: the body text, or a header,
+    /// footer, footnote or frame of the special sections
+    const SwNode& lcl_GetEndOfTextSection( const SwNode& rNd )
+    {
+        const SwNodes& rNds = rNd.GetNodes();
+        if( rNd.GetIndex() > rNds.GetEndOfExtras().GetIndex() )
+            return rNds.GetEndOfContent();
+
+        // the text sections of the special area are right below its top
+        // level sections, whose own section is the first node
+        const SwStartNode* pSttNd = rNd.StartOfSectionNode();
+        while( pSttNd->StartOfSectionNode()->StartOfSectionIndex() )
+            pSttNd = pSttNd->StartOfSectionNode();
+        return *pSttNd->EndOfSectionNode();
+    }
 }
 
 namespace sw
@@ -795,7 +811,7 @@ bool DocumentRedlineManager::AppendRedline( SwRangeRedline* pNewRedl, bool bCall
             return false;
         }
         bool bCompress = false;
-        sal_uInt16 n = 0;
+        SwRedlineTable::size_type n = 0;
         // look up the first Redline for the starting position
         if( !GetRedline( *pStt, &n ) && n )
             --n;
@@ -836,7 +852,7 @@ bool DocumentRedlineManager::AppendRedline( SwRangeRedline* pNewRedl, bool bCall
                              ( POS_COLLIDE_START == eCmpPos ) ||
                              ( POS_OVERLAP_BEHIND == eCmpPos ) ) &&
                             pRedl->CanCombine( *pNewRedl ) &&
-                            ( n+1 >= (sal_uInt16)mpRedlineTable->size() ||
+                            ( n+1 >= mpRedlineTable->size() ||
                              ( *(*mpRedlineTable)[ n+1 ]->Start() >= *pEnd &&
                              *(*mpRedlineTable)[ n+1 ]->Start() != *pREnd ) ) )
                         {
@@ -1143,7 +1159,7 @@ bool DocumentRedlineManager::AppendRedline( SwRangeRedline* pNewRedl, bool bCall
 
                             // delete current (below), and restart process with
                             // previous
-                            sal_uInt16 nToBeDeleted = n;
+                            SwRedlineTable::size_type nToBeDeleted = n;
                             bDec = true;
 
                             if( *(pNewRedl->Start()) <= *pREnd )
@@ -1615,7 +1631,7 @@ bool DocumentRedlineManager::AppendRedline( SwRangeRedline* pNewRedl, bool bCall
                     case POS_COLLIDE_START:
                         if( pRedl->IsOwnRedline( *pNewRedl ) &&
                             pRedl->CanCombine( *pNewRedl ) &&
-                            n+1 < (sal_uInt16)mpRedlineTable->size() &&
+                            n+1 < mpRedlineTable->size() &&
                             *(*mpRedlineTable)[ n+1 ]->Start() < *pEnd )
                         {
                             // If that's the case we can merge it, meaning
@@ -1782,7 +1798,7 @@ void DocumentRedlineManager::CompressRedlines()
     }
 
     // Try to merge identical ones
-    for( sal_uInt16 n = 1; n < mpRedlineTable->size(); ++n )
+    for( SwRedlineTable::size_type n = 1; n < mpRedlineTable->size(); ++n )
     {
         SwRangeRedline* pPrev = (*mpRedlineTable)[ n-1 ],
                     * pCur = (*mpRedlineTable)[ n ];
@@ -1817,7 +1833,7 @@ void DocumentRedlineManager::CompressRedlines()
 bool DocumentRedlineManager::SplitRedline( const SwPaM& rRange )
 {
     bool bChg = false;
-    sal_uInt16 n = 0;
+    SwRedlineTable::size_type n = 0;
     const SwPosition* pStt = rRange.Start();
     const SwPosition* pEnd = rRange.End();
     GetRedline( *pStt, &n );
@@ -1899,7 +1915,7 @@ bool DocumentRedlineManager::DeleteRedline( const SwPaM& rRange, bool bSaveInUnd
     const SwPosition* pStt = rRange.Start(),
                     * pEnd = pStt == rRange.GetPoint() ? rRange.GetMark()
                                                        : rRange.GetPoint();
-    sal_uInt16 n = 0;
+    SwRedlineTable::size_type n = 0;
     GetRedline( *pStt, &n );
     for( ; n < mpRedlineTable->size() ; ++n )
     {
@@ -2000,10 +2016,12 @@ bool DocumentRedlineManager::DeleteRedline( const SwStartNode& rNode, bool bSave
     return DeleteRedline(aTemp, bSaveInUndo, nDelType);
 }
 
-sal_uInt16 DocumentRedlineManager::GetRedlinePos( const SwNode& rNd, sal_uInt16 nType ) const
+SwRedlineTable::size_type DocumentRedlineManager::GetRedlinePos( const SwNode& rNd, sal_uInt16 nType ) const
 {
     const sal_uLong nNdIdx = rNd.GetIndex();
-    for( sal_uInt16 n = 0; n < mpRedlineTable->size() ; ++n )
+    // skip all redlines that end in front of the node
+    for( SwRedlineTable::size_type n = mpRedlineTable->FindFirstEndingAtOrAfter( SwPosition( rNd ) );
+         n < mpRedlineTable->size() ; ++n )
     {
         const SwRangeRedline* pTmp = (*mpRedlineTable)[ n ];
         sal_uLong nPt = pTmp->GetPoint()->nNode.GetIndex(),
@@ -2017,15 +2035,15 @@ sal_uInt16 DocumentRedlineManager::GetRedlinePos( const SwNode& rNd, sal_uInt16
         if( nMk > nNdIdx )
             break;
     }
-    return USHRT_MAX;
+    return SwRedlineTable::npos;
 
     // #TODO - add 'SwExtraRedlineTable' also ?
 }
 
 const SwRangeRedline* DocumentRedlineManager::GetRedline( const SwPosition& rPos,
-                                    sal_uInt16* pFndPos ) const
+                                    SwRedlineTable::size_type* pFndPos ) const
 {
-    sal_uInt16 nO = mpRedlineTable->size(), nM, nU = 0;
+    SwRedlineTable::size_type nO = mpRedlineTable->size(), nM, nU = 0;
     if( nO > 0 )
     {
         nO--;
@@ -2092,7 +2110,7 @@ const SwRangeRedline* DocumentRedlineManager::GetRedline( const SwPosition& rPos
     // #TODO - add 'SwExtraRedlineTable' also ?
 }
 
-bool DocumentRedlineManager::AcceptRedline( sal_uInt16 nPos, bool bCallDelete )
+bool DocumentRedlineManager::AcceptRedline( SwRedlineTable::size_type nPos, bool bCallDelete )
 {
     bool bRet = false;
 
@@ -2127,13 +2145,13 @@ bool DocumentRedlineManager::AcceptRedline( sal_uInt16 nPos, bool bCallDelete )
 
             if( nSeqNo )
             {
-                if( USHRT_MAX == nPos )
+                if( SwRedlineTable::npos == nPos )
                     nPos = 0;
-                sal_uInt16 nFndPos = 2 == nLoopCnt
+                SwRedlineTable::size_type nFndPos = 2 == nLoopCnt
                                     ? mpRedlineTable->FindNextSeqNo( nSeqNo, nPos )
                                     : mpRedlineTable->FindPrevSeqNo( nSeqNo, nPos );
-                if( USHRT_MAX != nFndPos || ( 0 != ( --nLoopCnt ) &&
-                    USHRT_MAX != ( nFndPos =
+                if( SwRedlineTable::npos != nFndPos || ( 0 != ( --nLoopCnt ) &&
+                    SwRedlineTable::npos != ( nFndPos =
                         mpRedlineTable->FindPrevSeqNo( nSeqNo, nPos ))) )
                     pTmp = (*mpRedlineTable)[ nPos = nFndPos ];
                 else
@@ -2206,7 +2224,7 @@ bool DocumentRedlineManager::AcceptRedline( const SwPaM& rPam, bool bCallDelete
     // #TODO - add 'SwExtraRedlineTable' also ?
 }
 
-bool DocumentRedlineManager::RejectRedline( sal_uInt16 nPos, bool bCallDelete )
+bool DocumentRedlineManager::RejectRedline( SwRedlineTable::size_type nPos, bool bCallDelete )
 {
     bool bRet = false;
 
@@ -2241,13 +2259,13 @@ bool DocumentRedlineManager::RejectRedline( sal_uInt16 nPos, bool bCallDelete )
 
             if( nSeqNo )
             {
-                if( USHRT_MAX == nPos )
+                if( SwRedlineTable::npos == nPos )
                     nPos = 0;
-                sal_uInt16 nFndPos = 2 == nLoopCnt
+                SwRedlineTable::size_type nFndPos = 2 == nLoopCnt
                                     ? mpRedlineTable->FindNextSeqNo( nSeqNo, nPos )
                                     : mpRedlineTable->FindPrevSeqNo( nSeqNo, nPos );
-                if( USHRT_MAX != nFndPos || ( 0 != ( --nLoopCnt ) &&
-                    USHRT_MAX != ( nFndPos =
+                if( SwRedlineTable::npos != nFndPos || ( 0 != ( --nLoopCnt ) &&
+                    SwRedlineTable::npos != ( nFndPos =
                             mpRedlineTable->FindPrevSeqNo( nSeqNo, nPos ))) )
                     pTmp = (*mpRedlineTable)[ nPos = nFndPos ];
                 else
@@ -2321,6 +2339,57 @@ bool DocumentRedlineManager::RejectRedline( const SwPaM& rPam, bool bCallDelete
     // #TODO - add 'SwExtraRedlineTable' also ?
 }
 
+bool DocumentRedlineManager::AcceptAllRedline( bool bAccept )
+{
+    if( mpRedlineTable->empty() )
+        return false;
+
+    // Switch to visible first, so that hidden deletions are back in the text
+    // before the range is taken
+    if( (nsRedlineMode_t::REDLINE_SHOW_INSERT | nsRedlineMode_t::REDLINE_SHOW_DELETE) !=
+        (nsRedlineMode_t::REDLINE_SHOW_MASK & meRedlineMode) )
+      SetRedlineMode( (RedlineMode_t)(nsRedlineMode_t::REDLINE_SHOW_INSERT | nsRedlineMode_t::REDLINE_SHOW_DELETE | meRedlineMode));
+
+    // The table is sorted and free of overlaps, so within a text section the
+    // range from the start of its first to the end of its last redline covers
+    // all of them. Going through the range variant handles them in one
+    // forward pass with one undo object, instead of an undo group, a
+    // CompressRedlines and a SetModified for every single redline. The range
+    // must not leave its section, so the body text and every header, footer,
+    // footnote and frame with redlines get a pass of their own.
+    const SwUndoId eUndoId = bAccept ? UNDO_ACCEPT_REDLINE : UNDO_REJECT_REDLINE;
+    if (m_rDoc.GetIDocumentUndoRedo().DoesUndo())
+        m_rDoc.GetIDocumentUndoRedo().StartUndo( eUndoId, NULL );
+
+    bool bRet = false;
+    SwRedlineTable::size_type n = 0;
+    while( n < mpRedlineTable->size() )
+    {
+        // moves along when nodes of the section are joined or split
+        const SwNodeIndex aSectEnd( lcl_GetEndOfTextSection(
+                                (*mpRedlineTable)[ n ]->Start()->nNode.GetNode() ) );
+        SwRedlineTable::size_type nLast = n;
+        while( nLast + 1 < mpRedlineTable->size() &&
+               (*mpRedlineTable)[ nLast + 1 ]->Start()->nNode < aSectEnd )
+            ++nLast;
+
+        SwPaM aPam( *(*mpRedlineTable)[ n ]->Start(),
+                    *(*mpRedlineTable)[ nLast ]->End() );
+        if( bAccept ? AcceptRedline( aPam, true ) : RejectRedline( aPam, true ) )
+            bRet = true;
+
+        // go on behind the section, skipping what was left in it: redlines
+        // in front of n are never removed, so this always makes progress
+        while( n < mpRedlineTable->size() &&
+               (*mpRedlineTable)[ n ]->Start()->nNode <= aSectEnd )
+            ++n;
+    }
+
+    if (m_rDoc.GetIDocumentUndoRedo().DoesUndo())
+        m_rDoc.GetIDocumentUndoRedo().EndUndo( eUndoId, NULL );
+    return bRet;
+}
+
 const SwRangeRedline* DocumentRedlineManager::SelNextRedline( SwPaM& rPam ) const
 {
     rPam.DeleteMark();
@@ -2332,7 +2401,7 @@ const SwRangeRedline* DocumentRedlineManager::SelNextRedline( SwPaM& rPam ) cons
 
     // If the starting position points to the last valid ContentNode,
     // we take the next Redline in any case.
-    sal_uInt16 n = 0;
+    SwRedlineTable::size_type n = 0;
     const SwRangeRedline* pFnd = GetRedlineTable().FindAtPosition( rSttPos, n, true );
     if( pFnd )
     {
@@ -2451,7 +2520,7 @@ const SwRangeRedline* DocumentRedlineManager::SelPrevRedline( SwPaM& rPam ) cons
 
     // If the starting position points to the last valid ContentNode,
     // we take the previous Redline in any case.
-    sal_uInt16 n = 0;
+    SwRedlineTable::size_type n = 0;
     const SwRangeRedline* pFnd = GetRedlineTable().FindAtPosition( rSttPos, n, false );
     if( pFnd )
     {
@@ -2568,7 +2637,7 @@ bool DocumentRedlineManager::SetRedlineComment( const SwPaM& rPaM, const OUStrin
     const SwPosition* pStt = rPaM.Start(),
                     * pEnd = pStt == rPaM.GetPoint() ? rPaM.GetMark()
                                                      : rPaM.GetPoint();
-    sal_uInt16 n = 0;
+    SwRedlineTable::size_type n = 0;
     if( GetRedlineTable().FindAtPosition( *pStt, n, true ) )
     {
         for( ; n < mpRedlineTable->size(); ++n )
@@ -2606,7 +2675,7 @@ sal_uInt16 DocumentRedlineManager::InsertRedlineAuthor( const OUString& rNew )
 void DocumentRedlineManager::UpdateRedlineAttr()
 {
     const SwRedlineTable& rTable = GetRedlineTable();
-    for( sal_uInt16 n = 0; n < rTable.size(); ++n )
+    for( SwRedlineTable::size_type n = 0; n < rTable.size(); ++n )
     {
         SwRangeRedline* pRedl = rTable[ n ];
         if( pRedl->IsVisible() )
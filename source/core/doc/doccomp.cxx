@@ -208,6 +208,9 @@ private:
     /// Look for the moved lines
     class CompareSequence
     {
+        /// Above this many lines, split the problem at lines unique to both sides first
+        static const sal_uLong CUTOFF = 2048;
+
         CompareData &rData1, &rData2;
         const MovedData &rMoved1, &rMoved2;
         long *pMemory, *pFDiag, *pBDiag;
@@ -215,9 +218,13 @@ private:
         void Compare( sal_uLong nStt1, sal_uLong nEnd1, sal_uLong nStt2, sal_uLong nEnd2 );
         sal_uLong CheckDiag( sal_uLong nStt1, sal_uLong nEnd1,
                         sal_uLong nStt2, sal_uLong nEnd2, sal_uLong* pCost );
+        void CompareAnchored( sal_uLong nDiff, const sal_uLong* pCount1,
+                        const sal_uLong* pCount2 );
     public:
         CompareSequence( CompareData& rData1, CompareData& rData2,
-                        const MovedData& rD1, const MovedData& rD2 );
+                        const MovedData& rD1, const MovedData& rD2,
+                        sal_uLong nDiff, const sal_uLong* pCount1,
+                        const sal_uLong* pCount2 );
         ~CompareSequence();
     };
 
@@ -263,9 +270,12 @@ class WordArrayComparator : public ArrayComparator
 private:
     const SwTextNode *pTextNd1, *pTextNd2;
     int *pPos1, *pPos2;
+    sal_uLong *pHash1, *pHash2;    // hash value of each word
     int nCnt1, nCnt2;		// number of words
 
     static void CalcPositions( int *pPos, const SwTextNode *pTextNd, int &nCnt );
+    static void CalcHashValues( sal_uLong *pHash, const int *pPos,
+                                const SwTextNode *pTextNd, int nCnt );
 
 public:
     WordArrayComparator( const SwTextNode *pNode1, const SwTextNode *pNode2 );
@@ -588,9 +598,6 @@ Compare::Compare( sal_uLong nDiff, CompareData& rData1, CompareData& rData2 )
         SetDiscard( rData1, pDiscard1, pCount2 );
         SetDiscard( rData2, pDiscard2, pCount1 );
 
-        // forget the arrays again
-        delete [] pCount1; delete [] pCount2;
-
         CheckDiscard( rData1.GetLineCount(), pDiscard1 );
         CheckDiscard( rData2.GetLineCount(), pDiscard2 );
 
@@ -599,10 +606,11 @@ Compare::Compare( sal_uLong nDiff, CompareData& rData1, CompareData& rData2 )
 
         // forget the arrays again
         delete [] pDiscard1; delete [] pDiscard2;
-    }
 
-    {
-        CompareSequence aTmp( rData1, rData2, *pMD1, *pMD2 );
+        CompareSequence aTmp( rData1, rData2, *pMD1, *pMD2,
+                                nDiff, pCount1, pCount2 );
+
+        delete [] pCount1; delete [] pCount2;
     }
 
     ShiftBoundaries( rData1, rData2 );
@@ -783,7 +791,9 @@ Compare::MovedData::~MovedData()
 /// Find the differing lines
 Compare::CompareSequence::CompareSequence(
                             CompareData& rD1, CompareData& rD2,
-                            const MovedData& rMD1, const MovedData& rMD2 )
+                            const MovedData& rMD1, const MovedData& rMD2,
+                            sal_uLong nDiff, const sal_uLong* pCount1,
+                            const sal_uLong* pCount2 )
     : rData1( rD1 ), rData2( rD2 ), rMoved1( rMD1 ), rMoved2( rMD2 )
 {
     sal_uLong nSize = rMD1.GetCount() + rMD2.GetCount() + 3;
@@ -791,7 +801,10 @@ Compare::CompareSequence::CompareSequence(
     pFDiag = pMemory + ( rMD2.GetCount() + 1 );
     pBDiag = pMemory + ( nSize + rMD2.GetCount() + 1 );
 
-    Compare( 0, rMD1.GetCount(), 0, rMD2.GetCount() );
+    if( rMD1.GetCount() + rMD2.GetCount() > CUTOFF )
+        CompareAnchored( nDiff, pCount1, pCount2 );
+    else
+        Compare( 0, rMD1.GetCount(), 0, rMD2.GetCount() );
 }
 
 Compare::CompareSequence::~CompareSequence()
@@ -799,6 +812,77 @@ Compare::CompareSequence::~CompareSequence()
     delete [] pMemory;
 }
 
+/** Split a big problem into independent smaller ones
+
+    The lines occurring exactly once in both documents are matched with
+    each other, and the longest run of these matches in the same order on
+    both sides is taken as fixed. Only the gaps between two such anchors are
+    searched for the differences, so the cost of the diagonal search depends
+    on the size of the gaps instead of on the size of the whole documents.
+*/
+void Compare::CompareSequence::CompareAnchored( sal_uLong nDiff,
+                const sal_uLong* pCount1, const sal_uLong* pCount2 )
+{
+    const sal_uLong nLen1 = rMoved1.GetCount(), nLen2 = rMoved2.GetCount();
+
+    // position in the second document of each line unique to both sides
+    std::vector<sal_uLong> aPos2( nDiff, ULONG_MAX );
+    for( sal_uLong n = 0; n < nLen2; ++n )
+    {
+        const sal_uLong nIdx = rMoved2.GetIndex( n );
+        if( 1 == pCount1[ nIdx ] && 1 == pCount2[ nIdx ] )
+            aPos2[ nIdx ] = n;
+    }
+
+    // pairs of matching positions, in the order of the first document
+    std::vector< std::pair<sal_uLong, sal_uLong> > aMatches;
+    for( sal_uLong n = 0; n < nLen1; ++n )
+    {
+        const sal_uLong nPos2 = aPos2[ rMoved1.GetIndex( n ) ];
+        if( ULONG_MAX != nPos2 )
+            aMatches.push_back( std::make_pair( n, nPos2 ) );
+    }
+
+    // longest increasing subsequence of the positions in the second document
+    std::vector<size_t> aTails, aPrev( aMatches.size(), 0 );
+    for( size_t i = 0; i < aMatches.size(); ++i )
+    {
+        size_t nLo = 0, nHi = aTails.size();
+        while( nLo < nHi )
+        {
+            const size_t nMid = nLo + ( nHi - nLo ) / 2;
+            if( aMatches[ aTails[ nMid ] ].second < aMatches[ i ].second )
+                nLo = nMid + 1;
+            else
+                nHi = nMid;
+        }
+        if( nLo )
+            aPrev[ i ] = aTails[ nLo - 1 ];
+        if( nLo == aTails.size() )
+            aTails.push_back( i );
+        else
+            aTails[ nLo ] = i;
+    }
+
+    std::vector<size_t> aAnchors( aTails.size() );
+    if( !aTails.empty() )
+    {
+        size_t n = aTails.back();
+        for( size_t i = aAnchors.size(); i; n = aPrev[ n ] )
+            aAnchors[ --i ] = n;
+    }
+
+    sal_uLong nStt1 = 0, nStt2 = 0;
+    for( size_t i = 0; i < aAnchors.size(); ++i )
+    {
+        const std::pair<sal_uLong, sal_uLong>& rMatch = aMatches[ aAnchors[ i ] ];
+        Compare( nStt1, rMatch.first, nStt2, rMatch.second );
+        nStt1 = rMatch.first + 1;
+        nStt2 = rMatch.second + 1;
+    }
+    Compare( nStt1, nLen1, nStt2, nLen2 );
+}
+
 void Compare::CompareSequence::Compare( sal_uLong nStt1, sal_uLong nEnd1,
                                         sal_uLong nStt2, sal_uLong nEnd2 )
 {
@@ -1950,7 +2034,7 @@ sal_uInt16 SaveMergeRedline::InsertRedline(SwPaM* pLastDestRedline)
         // If there already is a deleted or inserted one at the same position, we have to split it!
         SwPosition* pDStt = pDestRedl->GetMark(),
                   * pDEnd = pDestRedl->GetPoint();
-        sal_uInt16 n = 0;
+        SwRedlineTable::size_type n = 0;
 
             // find the first redline for StartPos
         if( !pDoc->getIDocumentRedlineAccess().GetRedline( *pDStt, &n ) && n )
@@ -2007,7 +2091,7 @@ sal_uInt16 SaveMergeRedline::InsertRedline(SwPaM* pLastDestRedline)
                         *pDStt = *pREnd;
 
                         // we should start over now
-                        n = USHRT_MAX;
+                        n = SwRedlineTable::npos;
                     }
                     break;
 
@@ -2232,16 +2316,30 @@ WordArrayComparator::WordArrayComparator( const SwTextNode *pNode1,
 
     CalcPositions( pPos1, pTextNd1, nCnt1 );
     CalcPositions( pPos2, pTextNd2, nCnt2 );
+
+    // The LCS search compares every word with many others: hash the words
+    // once, so that most of the comparisons don't need to look at the text.
+    pHash1 = new sal_uLong[ nCnt1 ];
+    pHash2 = new sal_uLong[ nCnt2 ];
+
+    CalcHashValues( pHash1, pPos1, pTextNd1, nCnt1 );
+    CalcHashValues( pHash2, pPos2, pTextNd2, nCnt2 );
 }
 
 WordArrayComparator::~WordArrayComparator()
 {
     delete[] pPos1;
     delete[] pPos2;
+    delete[] pHash1;
+    delete[] pHash2;
 }
 
 bool WordArrayComparator::Compare( int nIdx1, int nIdx2 ) const
 {
+    if( pHash1[ nIdx1 ] != pHash2[ nIdx2 ] )
+    {
+        return false;
+    }
     int nLen = pPos1[ nIdx1 + 1 ] - pPos1[ nIdx1 ];
     if( nLen != pPos2[ nIdx2 + 1 ] - pPos2[ nIdx2 ] )
     {
@@ -2306,6 +2404,19 @@ void WordArrayComparator::CalcPositions( int *pPos, const SwTextNode *pTextNd,
     }
 }
 
+void WordArrayComparator::CalcHashValues( sal_uLong *pHash, const int *pPos,
+                                          const SwTextNode *pTextNd, int nCnt )
+{
+    const OUString& rText = pTextNd->GetText();
+    for( int i = 0; i < nCnt; ++i )
+    {
+        sal_uLong nHash = 0;
+        for( int j = pPos[ i ]; j < pPos[ i + 1 ]; ++j )
+            nHash = nHash * 251 + rText[ j ];
+        pHash[ i ] = nHash;
+    }
+}
+
 int CommonSubseq::FindLCS( int *pLcs1, int *pLcs2, int nStt1, int nEnd1,
                                                     int nStt2, int nEnd2 )
 {
@@ -335,18 +335,15 @@ sal_Int32 _SetGetExpField::GetCntPosFromContent() const
     return nRet;
 }
 
-_HashStr::_HashStr( const OUString& rName, const OUString& rText,
-                    _HashStr* pNxt )
+_HashStr::_HashStr( const OUString& rName, const OUString& rText )
     : SwHash( rName ), aSetStr( rText )
 {
-    pNext = pNxt;
 }
 
 /// Look up the Name, if it is present, return it's String, otherwise return an empty String
-OUString LookString( SwHash** ppTable, sal_uInt16 nSize, const OUString& rName,
-                     sal_uInt16* pPos )
+OUString LookString( const SwHashTable& rTable, const OUString& rName )
 {
-    SwHash* pFnd = Find( comphelper::string::strip(rName, ' '), ppTable, nSize, pPos );
+    SwHash* pFnd = rTable.Find( comphelper::string::strip(rName, ' ') );
     if( pFnd )
         return static_cast<_HashStr*>(pFnd)->aSetStr;
 
@@ -1108,16 +1105,9 @@ void SwDocUpdateField::InsertFieldType( const SwFieldType& rType )
         SetFieldsDirty( true );
         // look up and remove from the hash table
         sFieldName = GetAppCharClass().lowercase( sFieldName );
-        sal_uInt16 n;
 
-        SwHash* pFnd = Find( sFieldName, GetFieldTypeTable(), TBLSZ, &n );
-
-        if( !pFnd )
-        {
-            SwCalcFieldType* pNew = new SwCalcFieldType( sFieldName, &rType );
-            pNew->pNext = aFieldTypeTable[ n ];
-            aFieldTypeTable[ n ] = pNew;
-        }
+        if( !aFieldTypeTable.Find( sFieldName ) )
+            aFieldTypeTable.Insert( new SwCalcFieldType( sFieldName, &rType ) );
     }
 }
 
@@ -1139,23 +1129,8 @@ void SwDocUpdateField::RemoveFieldType( const SwFieldType& rType )
         SetFieldsDirty( true );
         // look up and remove from the hash table
         sFieldName = GetAppCharClass().lowercase( sFieldName );
-        sal_uInt16 n;
 
-        SwHash* pFnd = Find( sFieldName, GetFieldTypeTable(), TBLSZ, &n );
-        if( pFnd )
-        {
-            if( aFieldTypeTable[ n ] == pFnd )
-                aFieldTypeTable[ n ] = static_cast<SwCalcFieldType*>(pFnd->pNext);
-            else
-            {
-                SwHash* pPrev = aFieldTypeTable[ n ];
-                while( pPrev->pNext != pFnd )
-                    pPrev = pPrev->pNext;
-                pPrev->pNext = pFnd->pNext;
-            }
-            pFnd->pNext = 0;
-            delete pFnd;
-        }
+        delete aFieldTypeTable.Remove( sFieldName );
     }
 }
 
@@ -1168,15 +1143,11 @@ SwDocUpdateField::SwDocUpdateField(SwDoc* pDoc)
     , bFieldsDirty(false)
 
 {
-    memset( aFieldTypeTable, 0, sizeof( aFieldTypeTable ) );
 }
 
 SwDocUpdateField::~SwDocUpdateField()
 {
     delete pFieldSortLst;
-
-    for( int n = 0; n < TBLSZ; ++n )
-        delete aFieldTypeTable[n];
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
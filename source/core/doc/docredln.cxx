@@ -307,7 +307,7 @@ bool SwRedlineTable::Insert( SwRangeRedline* p, bool bIns )
     return false;
 }
 
-bool SwRedlineTable::Insert( SwRangeRedline* p, sal_uInt16& rP, bool bIns )
+bool SwRedlineTable::Insert( SwRangeRedline* p, size_type& rP, bool bIns )
 {
     if( p->HasValidRange() )
     {
@@ -323,7 +323,7 @@ bool SwRedlineTable::Insert( SwRangeRedline* p, sal_uInt16& rP, bool bIns )
     return false;
 }
 
-bool SwRedlineTable::InsertWithValidRanges( SwRangeRedline* p, sal_uInt16* pInsPos )
+bool SwRedlineTable::InsertWithValidRanges( SwRangeRedline* p, size_type* pInsPos )
 {
     // Create valid "sub-ranges" from the Selection
     bool bAnyIns = false;
@@ -343,7 +343,7 @@ bool SwRedlineTable::InsertWithValidRanges( SwRangeRedline* p, sal_uInt16* pInsP
     }
 
     SwRangeRedline* pNew = 0;
-    sal_uInt16 nInsPos;
+    size_type nInsPos;
 
     if( aNewStt < *pEnd )
         do {
@@ -444,24 +444,26 @@ _SwRedlineTable::~_SwRedlineTable()
     DeleteAndDestroyAll();
 }
 
-sal_uInt16 SwRedlineTable::GetPos(const SwRangeRedline* p) const
+const SwRedlineTable::size_type SwRedlineTable::npos;
+
+SwRedlineTable::size_type SwRedlineTable::GetPos(const SwRangeRedline* p) const
 {
     const_iterator it = find(const_cast<SwRangeRedline* const>(p));
     if( it == end() )
-        return USHRT_MAX;
+        return npos;
     return it - begin();
 }
 
 bool SwRedlineTable::Remove( const SwRangeRedline* p )
 {
-    const sal_uInt16 nPos = GetPos(p);
-    if (nPos == USHRT_MAX)
+    const size_type nPos = GetPos(p);
+    if (nPos == npos)
         return false;
     Remove(nPos);
     return true;
 }
 
-void SwRedlineTable::Remove( sal_uInt16 nP )
+void SwRedlineTable::Remove( size_type nP )
 {
     SwDoc* pDoc = 0;
     if( !nP && 1 == size() )
@@ -480,7 +482,7 @@ void SwRedlineTable::DeleteAndDestroyAll()
     DeleteAndDestroy(0, size());
 }
 
-void SwRedlineTable::DeleteAndDestroy( sal_uInt16 nP, sal_uInt16 nL )
+void SwRedlineTable::DeleteAndDestroy( size_type nP, size_type nL )
 {
     SwDoc* pDoc = 0;
     if( !nP && nL && nL == size() )
@@ -496,31 +498,31 @@ void SwRedlineTable::DeleteAndDestroy( sal_uInt16 nP, sal_uInt16 nL )
         pSh->InvalidateWindows( SwRect( 0, 0, SAL_MAX_INT32, SAL_MAX_INT32 ) );
 }
 
-sal_uInt16 SwRedlineTable::FindNextOfSeqNo( sal_uInt16 nSttPos ) const
+SwRedlineTable::size_type SwRedlineTable::FindNextOfSeqNo( size_type nSttPos ) const
 {
-    return static_cast<size_t>(nSttPos) + 1 < size()
+    return nSttPos + 1 < size()
                 ? FindNextSeqNo( operator[]( nSttPos )->GetSeqNo(), nSttPos+1 )
-                : USHRT_MAX;
+                : npos;
 }
 
-sal_uInt16 SwRedlineTable::FindPrevOfSeqNo( sal_uInt16 nSttPos ) const
+SwRedlineTable::size_type SwRedlineTable::FindPrevOfSeqNo( size_type nSttPos ) const
 {
     return nSttPos ? FindPrevSeqNo( operator[]( nSttPos )->GetSeqNo(), nSttPos-1 )
-                   : USHRT_MAX;
+                   : npos;
 }
 
 /// Find the next or preceding Redline with the same seq.no.
 /// We can limit the search using look ahead (0 searches the whole array).
-sal_uInt16 SwRedlineTable::FindNextSeqNo( sal_uInt16 nSeqNo, sal_uInt16 nSttPos,
-                                    sal_uInt16 nLookahead ) const
+SwRedlineTable::size_type SwRedlineTable::FindNextSeqNo( sal_uInt16 nSeqNo, size_type nSttPos,
+                                    size_type nLookahead ) const
 {
-    sal_uInt16 nRet = USHRT_MAX;
+    size_type nRet = npos;
     if( nSeqNo && nSttPos < size() )
     {
-        size_t nEnd = size();
+        size_type nEnd = size();
         if( nLookahead )
         {
-            const size_t nTmp = static_cast<size_t>(nSttPos)+ static_cast<size_t>(nLookahead);
+            const size_type nTmp = nSttPos + nLookahead;
             if (nTmp < nEnd)
             {
                 nEnd = nTmp;
@@ -537,13 +539,13 @@ sal_uInt16 SwRedlineTable::FindNextSeqNo( sal_uInt16 nSeqNo, sal_uInt16 nSttPos,
     return nRet;
 }
 
-sal_uInt16 SwRedlineTable::FindPrevSeqNo( sal_uInt16 nSeqNo, sal_uInt16 nSttPos,
-                                    sal_uInt16 nLookahead ) const
+SwRedlineTable::size_type SwRedlineTable::FindPrevSeqNo( sal_uInt16 nSeqNo, size_type nSttPos,
+                                    size_type nLookahead ) const
 {
-    sal_uInt16 nRet = USHRT_MAX;
+    size_type nRet = npos;
     if( nSeqNo && nSttPos < size() )
     {
-        size_t nEnd = 0;
+        size_type nEnd = 0;
         if( nLookahead && nSttPos > nLookahead )
             nEnd = nSttPos - nLookahead;
 
@@ -559,10 +561,14 @@ sal_uInt16 SwRedlineTable::FindPrevSeqNo( sal_uInt16 nSeqNo, sal_uInt16 nSttPos,
 }
 
 const SwRangeRedline* SwRedlineTable::FindAtPosition( const SwPosition& rSttPos,
-                                        sal_uInt16& rPos,
+                                        size_type& rPos,
                                         bool bNext ) const
 {
     const SwRangeRedline* pFnd = 0;
+    // everything ending before rSttPos can neither match nor stop the search
+    const size_type nFirst = FindFirstEndingAtOrAfter( rSttPos );
+    if( rPos < nFirst )
+        rPos = nFirst;
     for( ; rPos < size() ; ++rPos )
     {
         const SwRangeRedline* pTmp = (*this)[ rPos ];
@@ -586,6 +592,31 @@ const SwRangeRedline* SwRedlineTable::FindAtPosition( const SwPosition& rSttPos,
     return pFnd;
 }
 
+SwRedlineTable::size_type SwRedlineTable::FindFirstEndingAtOrAfter( const SwPosition& rPos ) const
+{
+    // the table is sorted by the starts: find the first redline starting at
+    // or behind rPos, all of these end there or later
+    size_type nLow = 0, nHigh = size();
+    while( nLow < nHigh )
+    {
+        const size_type nMid = nLow + ( nHigh - nLow ) / 2;
+        if( *operator[]( nMid )->Start() < rPos )
+            nLow = nMid + 1;
+        else
+            nHigh = nMid;
+    }
+    // of the redlines starting in front of rPos, only the ones reaching rPos
+    // are directly in front, as redlines do not overlap
+    while( nLow && *operator[]( nLow - 1 )->End() >= rPos )
+        --nLow;
+    // only the neighbours are checked here, the whole table is checked by
+    // lcl_CheckRedline in DocumentRedlineManager
+    OSL_ENSURE( !nLow || nLow == size() ||
+                *operator[]( nLow - 1 )->End() <= *operator[]( nLow )->Start(),
+                "Redline: overlapping redlines in the table" );
+    return nLow;
+}
+
 void SwRedlineTable::dumpAsXml(xmlTextWriterPtr pWriter) const
 {
     xmlTextWriterStartElement(pWriter, BAD_CAST("swRedlineTable"));
@@ -1313,7 +1344,7 @@ void SwRangeRedline::DelCopyOfSection(size_t nMyPos)
                 // current ones can be affected.
                 const SwRedlineTable& rTable = pDoc->getIDocumentRedlineAccess().GetRedlineTable();
                 size_t n = nMyPos;
-                OSL_ENSURE( n != USHRT_MAX, "How strange. We don't exist!" );
+                OSL_ENSURE( n != SwRedlineTable::npos, "How strange. We don't exist!" );
                 for( bool bBreak = false; !bBreak && n > 0; )
                 {
                     --n;
@@ -713,6 +713,8 @@ static const SwTextNode* lcl_FindChapterNode( const SwNode& rNd, sal_uInt8 nLvl
 SwTOXBaseSection::SwTOXBaseSection(SwTOXBase const& rBase, SwSectionFormat & rFormat)
     : SwTOXBase( rBase )
     , SwSection( TOX_CONTENT_SECTION, OUString(), rFormat )
+    , bSortArrFlat( true )
+    , nSortArrLevel( 0 )
 {
     SetProtect( rBase.IsProtected() );
     SetSectionName( GetTOXName() );
@@ -836,9 +838,7 @@ void SwTOXBaseSection::Update(const SfxItemSet* pAttr,
                                GetOptions() : 0,
                                GetSortAlgorithm() );
 
-    for (SwTOXSortTabBases::const_iterator it = aSortArr.begin(); it != aSortArr.end(); ++it)
-        delete *it;
-    aSortArr.clear();
+    ClearSortArr();
 
     // find the first layout node for this TOX, if it only find the content
     // in his own chapter
@@ -946,6 +946,17 @@ void SwTOXBaseSection::Update(const SfxItemSet* pAttr,
     // Sort the List of all TOC Marks and TOC Sections
     std::vector<SwTextFormatColl*> aCollArr( GetTOXForm().GetFormMax(), 0 );
     SwNodeIndex aInsPos( *pFirstEmptyNd, 1 );
+
+    // pass node index of table-of-content section and default page description
+    // to the tab stop handler; one generator serves all entries.
+    std::shared_ptr<sw::ToxTabStopTokenHandler> tabStopTokenHandler =
+            std::make_shared<sw::DefaultToxTabStopTokenHandler>(
+                    pSectNd->GetIndex(), *pDefaultPageDesc, GetTOXForm().IsRelTabPos(),
+                    pDoc->GetDocumentSettingManager().get(DocumentSettingId::TABS_RELATIVE_TO_INDENT) ?
+                            sw::DefaultToxTabStopTokenHandler::TABSTOPS_RELATIVE_TO_INDENT :
+                            sw::DefaultToxTabStopTokenHandler::TABSTOPS_RELATIVE_TO_PAGE);
+    sw::ToxTextGenerator ttgn(GetTOXForm(), tabStopTokenHandler);
+
     for( SwTOXSortTabBases::size_type nCnt = 0; nCnt < aSortArr.size(); ++nCnt )
     {
         ::SetProgressState( 0, pDoc->GetDocShell() );
@@ -982,17 +993,8 @@ void SwTOXBaseSection::Update(const SfxItemSet* pAttr,
                     pNextMark->GetSecondaryKey() == sSecKey)
                 nRange++;
         }
-        // pass node index of table-of-content section and default page description
-        // to method <GenerateText(..)>.
         ::SetProgressState( 0, pDoc->GetDocShell() );
 
-        std::shared_ptr<sw::ToxTabStopTokenHandler> tabStopTokenHandler =
-                std::make_shared<sw::DefaultToxTabStopTokenHandler>(
-                        pSectNd->GetIndex(), *pDefaultPageDesc, GetTOXForm().IsRelTabPos(),
-                        pDoc->GetDocumentSettingManager().get(DocumentSettingId::TABS_RELATIVE_TO_INDENT) ?
-                                sw::DefaultToxTabStopTokenHandler::TABSTOPS_RELATIVE_TO_INDENT :
-                                sw::DefaultToxTabStopTokenHandler::TABSTOPS_RELATIVE_TO_PAGE);
-        sw::ToxTextGenerator ttgn(GetTOXForm(), tabStopTokenHandler);
         ttgn.GenerateText(GetFormat()->GetDoc(), aSortArr, nCnt, nRange);
         nCnt += nRange - 1;
     }
@@ -1063,7 +1065,7 @@ void SwTOXBaseSection::InsertAlphaDelimitter( const SwTOXInternational& rIntl )
                 SwTOXCustom* pCst = new SwTOXCustom( TextAndReading(sDeli, OUString()),
                                                      FORM_ALPHA_DELIMITTER,
                                                      rIntl, aSortArr[i]->GetLocale() );
-                aSortArr.insert( aSortArr.begin() + i, pCst);
+                InsertSortArr( i, pCst );
                 i++;
             }
             sLastDeli = sDeli;
@@ -1649,9 +1651,7 @@ void SwTOXBaseSection::UpdatePageNum()
         }
     }
     // Delete the mapping array after setting the right PageNumber
-    for (SwTOXSortTabBases::const_iterator it = aSortArr.begin(); it != aSortArr.end(); ++it)
-        delete *it;
-    aSortArr.clear();
+    ClearSortArr();
 }
 
 /// Replace the PageNumber place holders. Search for the page no. in the array
@@ -1828,6 +1828,26 @@ void SwTOXBaseSection::_UpdatePageNum( SwTextNode* pNd,
     }
 }
 
+void SwTOXBaseSection::InsertSortArr(long nPos, SwTOXSortTabBase* pBase)
+{
+    if( aSortArr.empty() )
+    {
+        bSortArrFlat = true;
+        nSortArrLevel = pBase->GetLevel();
+    }
+    if( pBase->GetType() != TOX_SORT_INDEX || pBase->GetLevel() != nSortArrLevel )
+        bSortArrFlat = false;
+    aSortArr.insert(aSortArr.begin() + nPos, pBase);
+}
+
+void SwTOXBaseSection::ClearSortArr()
+{
+    for (SwTOXSortTabBases::const_iterator it = aSortArr.begin(); it != aSortArr.end(); ++it)
+        delete *it;
+    aSortArr.clear();
+    bSortArrFlat = true;
+}
+
 void SwTOXBaseSection::InsertSorted(SwTOXSortTabBase* pNew)
 {
     Range aRange(0, aSortArr.size());
@@ -1852,7 +1872,7 @@ void SwTOXBaseSection::InsertSorted(SwTOXSortTabBase* pNew)
     // Search for identical entries and remove the trailing one
     if(TOX_AUTHORITIES == SwTOXBase::GetType())
     {
-        for(short i = (short)aRange.Min(); i < (short)aRange.Max(); ++i)
+        for(long i = aRange.Min(); i < aRange.Max(); ++i)
         {
             SwTOXSortTabBase* pOld = aSortArr[i];
             if(*pOld == *pNew)
@@ -1875,9 +1895,28 @@ void SwTOXBaseSection::InsertSorted(SwTOXSortTabBase* pNew)
     }
 
     // find position and insert
-    short i;
+    long i = aRange.Min();
+
+    // Keyword entries of one level are kept sorted, so if the array holds
+    // nothing else (tracked by InsertSortArr()), a binary search skips most
+    // of the comparisons.
+    if( TOX_INDEX == SwTOXBase::GetType() && TOX_SORT_INDEX == pNew->GetType() &&
+        0 == (GetOptions() & nsSwTOIOptions::TOI_KEY_AS_ENTRY) &&
+        bSortArrFlat && ( aSortArr.empty() || nSortArrLevel == pNew->GetLevel() ) )
+    {
+        long nHigh = aRange.Max();
+        while( i < nHigh )
+        {
+            const long nMid = i + ( nHigh - i ) / 2;
+            SwTOXSortTabBase* pOld = aSortArr[nMid];
+            if( *pOld == *pNew || *pNew < *pOld )
+                nHigh = nMid;
+            else
+                i = nMid + 1;
+        }
+    }
 
-    for( i = (short)aRange.Min(); i < (short)aRange.Max(); ++i)
+    for( ; i < aRange.Max(); ++i)
     {   // Only check for same level
         SwTOXSortTabBase* pOld = aSortArr[i];
         if(*pOld == *pNew)
@@ -1891,7 +1930,7 @@ void SwTOXBaseSection::InsertSorted(SwTOXSortTabBase* pNew)
 
                 if(!(SwTOXSortTabBase::GetOptions() & nsSwTOIOptions::TOI_SAME_ENTRY))
                 {   // Own entry
-                    aSortArr.insert(aSortArr.begin() + i, pNew);
+                    InsertSortArr(i, pNew);
                     return;
                 }
                 // If the own entry is already present, add it to the references list
@@ -1914,7 +1953,7 @@ void SwTOXBaseSection::InsertSorted(SwTOXSortTabBase* pNew)
         i++;
 
     // Insert at position i
-    aSortArr.insert(aSortArr.begin()+i, pNew);
+    InsertSortArr(i, pNew);
 }
 
 /// Find Key Range and insert if possible
@@ -1956,7 +1995,7 @@ Range SwTOXBaseSection::GetKeyRange(const OUString& rStr, const OUString& rStrRe
             if(nLevel == aSortArr[i]->GetLevel() &&  *pKey < *(aSortArr[i]))
                 break;
         }
-        aSortArr.insert(aSortArr.begin() + i, pKey);
+        InsertSortArr(i, pKey);
     }
     const long nStart = i+1;
     const long nEnd   = aSortArr.size();
@@ -46,6 +46,7 @@
 #include <ndtxt.hxx>
 #include <viewopt.hxx>
 #include <viscrs.hxx>
+#include <viewimp.hxx>
 #include <SwGrammarMarkUp.hxx>
 #include <mdiexp.hxx>
 #include <statstr.hrc>
@@ -701,6 +702,8 @@ uno::Any SwEditShell::SpellContinue(
         aRes <<= xRet;
     }
     --mnStartAction;
+    if( !mnStartAction )
+        Imp()->FlushInvalidRects();
 
     if( !aRet.isEmpty() || xRet.is() )
     {
@@ -783,6 +786,8 @@ uno::Reference< uno::XInterface >
     uno::Reference< uno::XInterface >  xRet;
     pHyphIter->Continue( pPageCnt, pPageSt ) >>= xRet;
     --mnStartAction;
+    if( !mnStartAction )
+        Imp()->FlushInvalidRects();
 
     if( xRet.is() )
         pHyphIter->ShowSelection();
@@ -809,6 +814,8 @@ void SwEditShell::HyphIgnore()
     ++mnStartAction;
     pHyphIter->Ignore();
     --mnStartAction;
+    if( !mnStartAction )
+        Imp()->FlushInvalidRects();
 
     pHyphIter->ShowSelection();
 }
@@ -1265,7 +1272,7 @@ static SpellContentPositions lcl_CollectDeletedRedlines(SwEditShell* pSh)
         const SwPosition* pStartPos = pCrsr->Start();
         const SwTextNode* pTextNode = pCrsr->GetNode().GetTextNode();
 
-        sal_uInt16 nAct = pDoc->getIDocumentRedlineAccess().GetRedlinePos( *pTextNode, USHRT_MAX );
+        SwRedlineTable::size_type nAct = pDoc->getIDocumentRedlineAccess().GetRedlinePos( *pTextNode, USHRT_MAX );
         const sal_Int32 nStartIndex = pStartPos->nContent.GetIndex();
         for ( ; nAct < pDoc->getIDocumentRedlineAccess().GetRedlineTable().size(); nAct++ )
         {
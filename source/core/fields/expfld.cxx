@@ -354,11 +354,10 @@ void SwGetExpField::ChangeExpansion( const SwFrm& rFrm, const SwTextField& rFiel
     _SetGetExpField aEndField( aPos.nNode, &rField, &aPos.nContent );
     if(GetSubType() & nsSwGetSetExpType::GSE_STRING)
     {
-        SwHash** ppHashTable;
-        sal_uInt16 nSize;
-        rDoc.getIDocumentFieldsAccess().FieldsToExpand( ppHashTable, nSize, aEndField );
-        sExpand = LookString( ppHashTable, nSize, GetFormula() );
-        ::DeleteHashTable( ppHashTable, nSize );
+        IDocumentFieldsAccess& rFieldsAccess = rDoc.getIDocumentFieldsAccess();
+        SwHashTable& rHashTable = rFieldsAccess.GetUpdateFields().GetExpandTable();
+        rFieldsAccess.FieldsToExpand( rHashTable, aEndField );
+        sExpand = LookString( rHashTable, GetFormula() );
     }
     else
     {
@@ -58,7 +58,7 @@ public:
     virtual void SetFixFields(bool bOnlyTimeDate, const DateTime* pNewDateTime) SAL_OVERRIDE;
     virtual void FieldsToCalc(SwCalc& rCalc, sal_uLong nLastNd, sal_uInt16 nLastCnt) SAL_OVERRIDE;
     virtual void FieldsToCalc(SwCalc& rCalc, const _SetGetExpField& rToThisField) SAL_OVERRIDE;
-    virtual void FieldsToExpand(SwHash**& ppTable, sal_uInt16& rTableSize, const _SetGetExpField& rToThisField) SAL_OVERRIDE;
+    virtual void FieldsToExpand(SwHashTable& rTable, const _SetGetExpField& rToThisField) SAL_OVERRIDE;
     virtual bool IsNewFieldLst() const SAL_OVERRIDE;
     virtual void SetNewFieldLst( bool bFlag) SAL_OVERRIDE;
     virtual void InsDelFieldInFieldLst(bool bIns, const SwTextField& rField) SAL_OVERRIDE;
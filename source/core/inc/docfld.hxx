@@ -117,7 +117,7 @@ public:
 struct _HashStr : public SwHash
 {
     OUString aSetStr;
-    _HashStr( const OUString& rName, const OUString& rText, _HashStr* = 0 );
+    _HashStr( const OUString& rName, const OUString& rText );
 };
 
 struct SwCalcFieldType : public SwHash
@@ -130,8 +130,7 @@ struct SwCalcFieldType : public SwHash
 };
 
 // search for the string that was saved under rName in the hash table
-OUString LookString( SwHash** ppTable, sal_uInt16 nSize, const OUString& rName,
-                     sal_uInt16* pPos = 0 );
+OUString LookString( const SwHashTable& rTable, const OUString& rName );
 
 const int GETFLD_ALL        = 3;        // combine flags via OR
 const int GETFLD_CALC       = 1;
@@ -140,7 +139,8 @@ const int GETFLD_EXPAND     = 2;
 class SwDocUpdateField
 {
     _SetGetExpFields* pFieldSortLst;    // current field list for calculation
-    SwCalcFieldType*  aFieldTypeTable[ TBLSZ ];
+    SwHashTable       aFieldTypeTable;  // of SwCalcFieldType
+    SwHashTable       aExpandTable;     // of _HashStr, refilled by FieldsToExpand
 
     sal_uLong nNodes;               // if the node count is different
     sal_uInt8 nFieldLstGetMode;
@@ -180,7 +180,9 @@ public:
         }
     }
 
-    SwHash* const * GetFieldTypeTable() const { return reinterpret_cast<SwHash* const *>(aFieldTypeTable); }
+    const SwHashTable& GetFieldTypeTable() const { return aFieldTypeTable; }
+    /// string table for FieldsToExpand, kept to reuse its buckets
+    SwHashTable& GetExpandTable() { return aExpandTable; }
 };
 
 #endif
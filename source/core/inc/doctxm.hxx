@@ -36,6 +36,9 @@ typedef std::vector<SwTOXSortTabBase*> SwTOXSortTabBases;
 class SwTOXBaseSection : public SwTOXBase, public SwSection
 {
     SwTOXSortTabBases aSortArr;
+    // true if aSortArr holds plain keyword entries of level nSortArrLevel only
+    bool bSortArrFlat;
+    sal_uInt16 nSortArrLevel;
 
     void UpdateMarks( const SwTOXInternational& rIntl,
                       const SwTextNode* pOwnChapterNode );
@@ -50,6 +53,9 @@ class SwTOXBaseSection : public SwTOXBase, public SwSection
 
     // insert sorted into array for creation
     void InsertSorted(SwTOXSortTabBase* pBase);
+    // insert into aSortArr at nPos, keeping bSortArrFlat up to date
+    void InsertSortArr(long nPos, SwTOXSortTabBase* pBase);
+    void ClearSortArr();
 
     // insert alpha delimiter at creation
     void InsertAlphaDelimitter( const SwTOXInternational& rIntl );
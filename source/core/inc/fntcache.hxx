@@ -21,8 +21,11 @@
 #define INCLUDED_SW_SOURCE_CORE_INC_FNTCACHE_HXX
 
 #include <vcl/font.hxx>
+#include <vcl/outdevstate.hxx>
+#include <i18nlangtag/lang.h>
 #include <vcl/vclptr.hxx>
 #include <tools/mempool.hxx>
+#include <vector>
 #include "swtypes.hxx"
 #include "swcache.hxx"
 
@@ -37,12 +40,28 @@ class Point;
 
 class SwFntCache : public SwCache
 {
+#ifdef DBG_UTIL
+    long m_nTextWidthHit;     /// number of text measurements found in a SwFntObj
+    long m_nTextWidthMiss;    /// number of text measurements done and stored
+#endif
+
 public:
     inline SwFntCache() : SwCache(50
 #ifdef DBG_UTIL
     , OString(RTL_CONSTASCII_STRINGPARAM("Global Font-Cache pFntCache"))
 #endif
-    ) {}
+    )
+#ifdef DBG_UTIL
+    , m_nTextWidthHit( 0 )
+    , m_nTextWidthMiss( 0 )
+#endif
+    { SetGrowLimit( 250 ); }
+#ifdef DBG_UTIL
+    ~SwFntCache();
+
+    void CountTextWidth( const bool bHit )
+        { if ( bHit ) ++m_nTextWidthHit; else ++m_nTextWidthMiss; }
+#endif
 
     inline SwFntObj *First( );
     static inline SwFntObj *Next( SwFntObj *pFntObj);
@@ -55,6 +74,27 @@ extern SwFntObj *pLastFont;
 extern sal_uInt8 *pMagicNo;
 extern Color *pWaveCol;
 
+/// Number of texts a SwFntObj remembers the measurements of
+#define TEXTWIDTH_SLOTS 64
+
+/// Measurements of a text at the reference device of a SwFntObj
+struct SwTextWidthEntry
+{
+    OUString aText;
+    sal_Int32 nHash;
+    ComplexTextLayoutMode nLayoutMode;
+    LanguageType eDigitLanguage;
+    long nWidth;                    ///< GetTextWidth, -1 if not measured yet
+    std::vector<long> aKernArray;   ///< GetTextArray, empty if not measured yet
+    long nBreakWidth;               ///< arguments of the last GetTextBreak
+    long nBreakKern;
+    sal_Int32 nBreak;               ///< its result relative to the text, -2 if none
+
+    SwTextWidthEntry() : nHash( 0 ), nLayoutMode( TEXT_LAYOUT_DEFAULT ),
+        eDigitLanguage( LANGUAGE_DONTKNOW ), nWidth( -1 ),
+        nBreakWidth( 0 ), nBreakKern( 0 ), nBreak( -2 ) {}
+};
+
 class SwFntObj : public SwCacheObj
 {
     friend class SwFntAccess;
@@ -65,6 +105,8 @@ class SwFntObj : public SwCacheObj
     vcl::Font *pScrFont;
     vcl::Font *pPrtFont;
     VclPtr<OutputDevice> pPrinter;
+    /// direct mapped cache of the texts measured at pPrinter
+    SwTextWidthEntry *pTextWidths;
     sal_uInt16 nGuessedLeading;
     sal_uInt16 nExtLeading;
     sal_uInt16 nScrAscent;
@@ -84,6 +126,12 @@ class SwFntObj : public SwCacheObj
        sal_Int32 nWrLen, sal_Int32 nCnt, const bool bSwitchH2V, const bool bSwitchL2R,
        long nHalfSpace, long* pKernArray, const bool bBidiPor);
 
+    /// set the reference device, drops the measurements at the old one
+    void SetPrt( OutputDevice* pPrt );
+    SwTextWidthEntry* GetTextWidthEntry( const SwDrawTextInfo& rInf, const sal_Int32 nLn );
+    long GetPrtTextWidth( SwDrawTextInfo& rInf, const sal_Int32 nLn );
+    void GetPrtTextArray( SwDrawTextInfo& rInf, long* pKernArray, const sal_Int32 nLn );
+
 public:
     DECL_FIXEDMEMPOOL_NEWDEL(SwFntObj)
 
@@ -114,6 +162,9 @@ public:
     void   DrawText( SwDrawTextInfo &rInf );
     /// determine the TextSize (of the printer)
     Size  GetTextSize( SwDrawTextInfo &rInf );
+    /// GetTextBreak at the reference device, which rInf has to output to
+    sal_Int32 GetPrtTextBreak( SwDrawTextInfo& rInf, long nTextWidth,
+                               const sal_Int32 nLn, long nKern );
     sal_Int32 GetCrsrOfst( SwDrawTextInfo &rInf );
 
     void CreateScrFont( const SwViewShell& rSh, const OutputDevice& rOut );
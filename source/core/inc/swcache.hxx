@@ -41,8 +41,17 @@
  * The cache can be grown and shrunk in size.
  * E.g.: The cache for FormatInfo is grown for every new Shell and shrunk
  * when destroying them.
+ * With a grow limit set, objects at the end of the LRU chain which were
+ * accessed again get a second chance before being replaced; if many of them
+ * do, the cache grows on its own (up to the limit) instead.
+ *
+ * Searching by owner does not walk the LRU chain but uses a hash map.
+ *
+ * The cache is not thread-safe; like the rest of the core it relies on the
+ * SolarMutex being held by its users.
  */
 
+#include <unordered_map>
 #include <vector>
 
 #include <rtl/ustring.hxx>
@@ -50,9 +59,11 @@
 class SwCacheObj;
 
 typedef std::vector<SwCacheObj*> SwCacheObjArr;
+typedef std::unordered_map<const void*, SwCacheObj*> SwCacheOwnerMap;
 class SwCache
 {
     SwCacheObjArr m_aCacheObjects;
+    SwCacheOwnerMap m_aOwners;              /// Owner -> object, for the Get() without index
     std::vector<sal_uInt16> aFreePositions; /// Free positions for the Insert if the maximum has not been reached
                                             /// Every time an object is deregistered, its position is added here
     SwCacheObj *pRealFirst;                 /// _ALWAYS_ the real first LRU
@@ -60,8 +71,10 @@ class SwCache
     SwCacheObj *pLast;
 
     sal_uInt16 nCurMax;                     // Maximum of accepted objects
+    sal_uInt16 nGrowLimit;                  // Maximum nCurMax may grow to on its own
 
     void DeleteObj( SwCacheObj *pObj );
+    void RemoveOwner( SwCacheObj *pObj );
 
 #ifdef DBG_UTIL
     OString m_aName;
@@ -73,11 +86,11 @@ class SwCache
     long m_nToTop;            /// number of reordering (LRU)
     long m_nDelete;           /// number of explicit deletes
     long m_nGetSeek;          /// number of gets without index
-    long m_nAverageSeekCnt;   /// number of seeks for all gets without index
     long m_nFlushCnt;         /// number of flush calls
     long m_nFlushedObjects;
     long m_nIncreaseMax;      /// number of cache size increases
     long m_nDecreaseMax;      /// number of cache size decreases
+    long m_nAutoGrow;         /// number of automatic cache size increases
 
     void Check();
 #endif
@@ -111,6 +124,8 @@ public:
     inline void IncreaseMax( const sal_uInt16 nAdd );
     inline void DecreaseMax( const sal_uInt16 nSub );
     sal_uInt16 GetCurMax() const { return nCurMax; }
+    /// Allow growing up to nLimit instead of replacing recently used objects
+    void SetGrowLimit( const sal_uInt16 nLimit ) { nGrowLimit = nLimit; }
     inline SwCacheObj *First() { return pRealFirst; }
     inline SwCacheObj *Last()  { return pLast; }
     static inline SwCacheObj *Next( SwCacheObj *pCacheObj);
@@ -144,6 +159,7 @@ class SwCacheObj
     sal_uInt16 nCachePos;   /// Position in the Cache array
 
     sal_uInt8       nLock;
+    bool            bUsed;  /// Accessed again since it was inserted or got its second chance
 
     inline SwCacheObj *GetNext() { return pNext; }
     inline SwCacheObj *GetPrev() { return pPrev; }
@@ -0,0 +1,66 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDED_SW_SOURCE_CORE_INC_TILECACHE_HXX
+#define INCLUDED_SW_SOURCE_CORE_INC_TILECACHE_HXX
+
+#include <tools/gen.hxx>
+#include <vcl/bitmap.hxx>
+#include <list>
+
+/**
+ * Rendered tiles of SwViewShell::PaintTile(), so that requesting an unchanged
+ * tile again (another client, panning back, switching zoom levels back and
+ * forth) doesn't need a full Paint().
+ *
+ * A tile is identified by its area in twips and its size in pixels, which
+ * also determines the zoom. Tiles are dropped as soon as the window of the
+ * view shell gets an invalidation overlapping them.
+ */
+class SwTileCache
+{
+    struct Tile
+    {
+        Rectangle maArea;   ///< document area in twips
+        Size maOutputSize;  ///< size in pixels
+        Bitmap maBitmap;
+    };
+
+    /// Least recently used tile first.
+    std::list<Tile> maTiles;
+    /// Invalidations are ignored while this is non-zero.
+    sal_uInt16 mnLockCount;
+    sal_uInt32 mnHits;
+    sal_uInt32 mnMisses;
+
+public:
+    /// Upper limit of tiles kept around.
+    static const size_t MAX_TILES = 128;
+
+    SwTileCache();
+    ~SwTileCache();
+
+    /// Looks up a tile; on success rBitmap is set and the tile is marked as used.
+    bool Get(const Rectangle& rArea, const Size& rOutputSize, Bitmap& rBitmap);
+    void Put(const Rectangle& rArea, const Size& rOutputSize, const Bitmap& rBitmap);
+
+    /// Drops the tiles overlapping pArea, all of them if pArea is 0.
+    void Invalidate(const Rectangle* pArea);
+
+    /// Invalidations that don't change the contents (e.g. moving the visible area) can be ignored.
+    void Lock() { ++mnLockCount; }
+    void Unlock() { --mnLockCount; }
+
+    sal_uInt32 GetHits() const { return mnHits; }
+    sal_uInt32 GetMisses() const { return mnMisses; }
+};
+
+#endif
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
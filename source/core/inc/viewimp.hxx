@@ -45,6 +45,7 @@ class SwPrintData;
 class SwPagePreviewLayout;
 struct PreviewPage;
 class SwTextFrm;
+class SwTileCache;
 // --> OD #i76669#
 namespace sdr { namespace contact {
         class ViewObjectContactRedirector;
@@ -69,6 +70,8 @@ class SwViewShellImp
 
     SwPageFrm     *pFirstVisPage; // Always points to the first visible Page
     SwRegionRects *pRegion;       // Collector of Paintrects from the LayAction
+    SwRegionRects *pInvalidRegion; // Window invalidations collected during an action (tiled rendering)
+    sal_uInt16 nInvalidBudget;    // Max. number of rectangles flushed from pInvalidRegion
 
     SwLayAction   *pLayAct;      // Is set if an Action object exists
                                  // Is registered by the SwLayAction ctor and deregistered by the dtor
@@ -76,6 +79,8 @@ class SwViewShellImp
 
     SwAccessibleMap *pAccMap;    // Accessible wrappers
 
+    SwTileCache *pTileCache;     // Tiles painted by SwViewShell::PaintTile()
+
     mutable const SdrObject * pSdrObjCached;
     mutable OUString sSdrObjCachedComment;
 
@@ -154,6 +159,13 @@ public:
     SwRegionRects *GetRegion()      { return pRegion; }
     void DelRegion();
 
+    /// Collects a window invalidation till the end of the action, see SwViewShell::InvalidateWindows().
+    void AddInvalidRect( const SwRect &rRect );
+    /// Invalidates the window with the merged rectangles collected so far.
+    void FlushInvalidRects();
+    sal_uInt16 GetInvalidBudget() const { return nInvalidBudget; }
+    void SetInvalidBudget( sal_uInt16 nBudget ) { nInvalidBudget = nBudget; }
+
     /// New Interface for StarView Drawing
     bool  HasDrawView()             const { return 0 != pDrawView; }
           SwDrawView* GetDrawView()       { return pDrawView; }
@@ -220,6 +232,10 @@ public:
         return mpPgPreviewLayout;
     }
 
+    /// Created on first use, i.e. by the first tile painted.
+    SwTileCache& GetTileCache();
+    bool HasTileCache() const { return pTileCache != 0; }
+
     /// Is this view accessible?
     bool IsAccessible() const { return pAccMap != 0; }
 
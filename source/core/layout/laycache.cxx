@@ -18,6 +18,8 @@
  */
 
 #include <editeng/formatbreakitem.hxx>
+#include <osl/endian.h>
+#include <rtl/crc.h>
 #include <doc.hxx>
 #include <IDocumentStatistics.hxx>
 #include <IDocumentLayoutAccess.hxx>
@@ -70,11 +72,65 @@ void SwLayoutCache::Read( SvStream &rStream )
     }
 }
 
-void SwLayCacheImpl::Insert( sal_uInt16 nType, sal_uLong nIndex, sal_Int32 nOffset )
+void SwLayCacheImpl::Insert( sal_uInt16 nType, sal_uLong nIndex, sal_Int32 nOffset,
+                             sal_uInt32 nChecksum )
 {
     aType.push_back( nType );
     mIndices.push_back( nIndex );
     aOffset.push_back( nOffset );
+    aChecksum.push_back( nChecksum );
+}
+
+sal_uInt32 SwLayCacheImpl::GetChecksum( const OUString& rText )
+{
+    // CRC-32 of the UTF-16LE encoded text, independent of the platform
+#ifdef OSL_BIGENDIAN
+    sal_uInt32 nRet = 0;
+    for( sal_Int32 i = 0; i < rText.getLength(); ++i )
+    {
+        const sal_Unicode c = rText[ i ];
+        const sal_uInt8 aBytes[ 2 ] = { sal_uInt8( c & 0xff ), sal_uInt8( c >> 8 ) };
+        nRet = rtl_crc32( nRet, aBytes, sizeof( aBytes ) );
+    }
+#else
+    sal_uInt32 nRet = rtl_crc32( 0, rText.getStr(),
+                                 rText.getLength() * sizeof( sal_Unicode ) );
+#endif
+    return nRet ? nRet : 1;
+}
+
+void SwLayCacheImpl::Validate( const SwDoc& rDoc )
+{
+    if( bValidated )
+        return;
+    bValidated = true;
+
+    const SwNodes& rNodes = rDoc.GetNodes();
+    const sal_uLong nStartOfContent = rNodes.GetEndOfContent().
+                                      StartOfSectionNode()->GetIndex();
+    const sal_uLong nEndOfContent = rNodes.GetEndOfContent().GetIndex();
+    for( size_t i = 0; i < mIndices.size(); ++i )
+    {
+        if( SW_LAYCACHE_IO_REC_PARA != aType[ i ] || !aChecksum[ i ] )
+            continue;
+        const sal_uLong nIndex = nStartOfContent + mIndices[ i ];
+        const SwTextNode* pTextNd = nIndex < nEndOfContent ?
+                                    rNodes[ nIndex ]->GetTextNode() : NULL;
+        if( !pTextNd || GetChecksum( pTextNd->GetText() ) != aChecksum[ i ] ||
+            ( COMPLETE_STRING != aOffset[ i ] &&
+              aOffset[ i ] > pTextNd->GetText().getLength() ) )
+        {
+            // this break and all following ones are unreliable
+            SAL_INFO( "sw.layout", "layout cache does not match content, "
+                      << ( mIndices.size() - i ) << " of "
+                      << mIndices.size() << " page breaks dropped" );
+            mIndices.resize( i );
+            aOffset.resize( i );
+            aType.resize( i );
+            aChecksum.resize( i );
+            break;
+        }
+    }
 }
 
 bool SwLayCacheImpl::Read( SvStream& rStream )
@@ -107,8 +163,12 @@ bool SwLayCacheImpl::Read( SvStream& rStream )
                 aIo.GetStream().ReadUInt32( nOffset );
             else
                 nOffset = COMPLETE_STRING;
+            sal_uInt32 nChecksum(0);
+            if( (cFlags & 0x02) != 0 )
+                aIo.GetStream().ReadUInt32( nChecksum );
             aIo.CloseFlagRec();
-            Insert( SW_LAYCACHE_IO_REC_PARA, nIndex, (sal_Int32)nOffset );
+            Insert( SW_LAYCACHE_IO_REC_PARA, nIndex, (sal_Int32)nOffset,
+                    nChecksum );
             aIo.CloseRec( SW_LAYCACHE_IO_REC_PARA );
             break;
         }
@@ -151,6 +211,7 @@ bool SwLayCacheImpl::Read( SvStream& rStream )
  * If at the top of a page is the rest of a paragraph/table
  * from the bottom of the previous page, the character/row
  * number is stored, too.
+ * For paragraphs a checksum of the text is stored, too.
  * The position, size and page number of the text frames
  * are stored, too
  */
@@ -190,12 +251,14 @@ void SwLayoutCache::Write( SvStream &rStream, const SwDoc& rDoc )
                             /*  Open Paragraph Record */
                             aIo.OpenRec( SW_LAYCACHE_IO_REC_PARA );
                             bool bFollow = static_cast<SwTextFrm*>(pTmp)->IsFollow();
-                            aIo.OpenFlagRec( bFollow ? 0x01 : 0x00,
-                                            bFollow ? 8 : 4 );
+                            aIo.OpenFlagRec( bFollow ? 0x03 : 0x02,
+                                            bFollow ? 12 : 8 );
                             nNdIdx -= nStartOfContent;
                             aIo.GetStream().WriteUInt32( nNdIdx );
                             if( bFollow )
                                 aIo.GetStream().WriteUInt32( static_cast<SwTextFrm*>(pTmp)->GetOfst() );
+                            aIo.GetStream().WriteUInt32( SwLayCacheImpl::GetChecksum(
+                                static_cast<SwTextFrm*>(pTmp)->GetTextNode()->GetText() ) );
                             aIo.CloseFlagRec();
                             /*  Close Paragraph Record */
                             aIo.CloseRec( SW_LAYCACHE_IO_REC_PARA );
@@ -481,6 +544,7 @@ SwLayHelper::SwLayHelper( SwDoc *pD, SwFrm* &rpF, SwFrm* &rpP, SwPageFrm* &rpPg,
     pImpl = pDoc->GetLayoutCache() ? pDoc->GetLayoutCache()->LockImpl() : NULL;
     if( pImpl )
     {
+        pImpl->Validate( *pDoc );
         nMaxParaPerPage = 1000;
         nStartOfContent = pDoc->GetNodes().GetEndOfContent().StartOfSectionNode()
                           ->GetIndex();
@@ -20,6 +20,7 @@
 #ifndef INCLUDED_SW_SOURCE_CORE_LAYOUT_LAYHELP_HXX
 #define INCLUDED_SW_SOURCE_CORE_LAYOUT_LAYHELP_HXX
 
+#include <rtl/ustring.hxx>
 #include <swrect.hxx>
 #include <vector>
 #include <deque>
@@ -44,6 +45,11 @@ class SvStream;
  * and if it's not the first part of the table/paragraph,
  * the row/character-offset inside the table/paragraph.
  * The text frame positions are stored in the SwPageFlyCache array.
+ * Since version 1.2 every paragraph break carries a checksum of the
+ * paragraph text (CRC-32 of the UTF-16LE encoded text, 1 instead of 0),
+ * so that breaks which do not fit to the loaded content
+ * (e.g. the file was modified by another application) are dropped
+ * before they are used.
  */
 
 class SwFlyCache;
@@ -54,17 +60,28 @@ class SwLayCacheImpl
     std::vector<sal_uLong> mIndices;
     std::deque<sal_Int32> aOffset;
     std::vector<sal_uInt16> aType;
+    std::vector<sal_uInt32> aChecksum;  ///< 0: unknown
     SwPageFlyCache aFlyCache;
     bool bUseFlyCache;
-    void Insert( sal_uInt16 nType, sal_uLong nIndex, sal_Int32 nOffset );
+    bool bValidated;
+    void Insert( sal_uInt16 nType, sal_uLong nIndex, sal_Int32 nOffset,
+                 sal_uInt32 nChecksum = 0 );
 
 public:
-    SwLayCacheImpl() : mIndices(), aOffset(), aType(), aFlyCache(), bUseFlyCache(false) {}
+    SwLayCacheImpl() : mIndices(), aOffset(), aType(), aChecksum(), aFlyCache(),
+        bUseFlyCache(false), bValidated(false) {}
 
     size_t size() const { return mIndices.size(); }
 
     bool Read( SvStream& rStream );
 
+    /// Drop the page breaks from the first one whose paragraph does not
+    /// match its checksum on. Only done once, after the content is loaded.
+    void Validate( const SwDoc& rDoc );
+
+    /// Checksum of a paragraph text, never 0
+    static sal_uInt32 GetChecksum( const OUString& rText );
+
     sal_uLong GetBreakIndex( sal_uInt16 nIdx ) const { return mIndices[ nIdx ]; }
     sal_Int32 GetBreakOfst( size_t nIdx ) const { return aOffset[ nIdx ]; }
     sal_uInt16 GetBreakType( sal_uInt16 nIdx ) const { return aType[ nIdx ]; }
@@ -135,7 +152,7 @@ public:
 #define SW_LAYCACHE_IO_REC_FLY      'F'
 
 #define SW_LAYCACHE_IO_VERSION_MAJOR    1
-#define SW_LAYCACHE_IO_VERSION_MINOR    1
+#define SW_LAYCACHE_IO_VERSION_MINOR    2
 
 class SwLayCacheIoImpl
 {
@@ -40,6 +40,7 @@
 #include <txtcache.hxx>
 #include <flyfrm.hxx>
 #include <redlnitr.hxx>
+#include <docary.hxx>
 #include <swmodule.hxx>
 #include <tabfrm.hxx>
 #include <numrule.hxx>
@@ -384,7 +385,7 @@ void SwTextFrm::PaintExtraData( const SwRect &rRect ) const
         }
         else
         {
-            if ( USHRT_MAX == pIDRA->GetRedlinePos(rTextNode, USHRT_MAX) )
+            if ( SwRedlineTable::npos == pIDRA->GetRedlinePos(rTextNode, USHRT_MAX) )
                 bRedLine = false;
 
             if( bLineNum && rLineInf.IsCountBlankLines() &&
@@ -481,8 +482,8 @@ bool SwTextFrm::PaintEmpty( const SwRect &rRect, bool bCheck ) const
             const IDocumentRedlineAccess* pIDRA = rTextNode.getIDocumentRedlineAccess();
             if( IDocumentRedlineAccess::IsShowChanges( pIDRA->GetRedlineMode() ) )
             {
-                const sal_uInt16 nRedlPos = pIDRA->GetRedlinePos( rTextNode, USHRT_MAX );
-                if( USHRT_MAX != nRedlPos )
+                const SwRedlineTable::size_type nRedlPos = pIDRA->GetRedlinePos( rTextNode, USHRT_MAX );
+                if( SwRedlineTable::npos != nRedlPos )
                 {
                     SwAttrHandler aAttrHandler;
                     aAttrHandler.Init(  rTextNode.GetSwAttrSet(),
@@ -40,6 +40,7 @@
 #include <pagedesc.hxx>
 #include <frmatr.hxx>
 #include <redlnitr.hxx>
+#include <docary.hxx>
 #include <porfly.hxx>
 #include <atrhndl.hxx>
 #include "rootfrm.hxx"
@@ -250,8 +251,8 @@ SwTwips SwTextFrm::EmptyHeight() const
     const IDocumentRedlineAccess* pIDRA = rTextNode.getIDocumentRedlineAccess();
     if( IDocumentRedlineAccess::IsShowChanges( pIDRA->GetRedlineMode() ) )
     {
-        const sal_uInt16 nRedlPos = pIDRA->GetRedlinePos( rTextNode, USHRT_MAX );
-        if( USHRT_MAX != nRedlPos )
+        const SwRedlineTable::size_type nRedlPos = pIDRA->GetRedlinePos( rTextNode, USHRT_MAX );
+        if( SwRedlineTable::npos != nRedlPos )
         {
             SwAttrHandler aAttrHandler;
             aAttrHandler.Init(  GetTextNode()->GetSwAttrSet(),
@@ -132,8 +132,8 @@ void SwAttrIter::CtorInitAttrIter( SwTextNode& rTextNode, SwScriptInfo& rScrInf,
     const bool bShow = IDocumentRedlineAccess::IsShowChanges( pIDRA->GetRedlineMode() );
     if( pExtInp || bShow )
     {
-        const sal_uInt16 nRedlPos = pIDRA->GetRedlinePos( rTextNode, USHRT_MAX );
-        if( pExtInp || USHRT_MAX != nRedlPos )
+        const SwRedlineTable::size_type nRedlPos = pIDRA->GetRedlinePos( rTextNode, USHRT_MAX );
+        if( pExtInp || SwRedlineTable::npos != nRedlPos )
         {
             const std::vector<sal_uInt16> *pArr = 0;
             sal_Int32 nInputStt = 0;
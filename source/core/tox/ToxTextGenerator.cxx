@@ -149,6 +149,24 @@ ToxTextGenerator::GenerateTextForChapterToken(const SwFormToken& chapterToken, c
     return retval;
 }
 
+SwCharFormat*
+ToxTextGenerator::GetCharFormatOfToken(const SwFormToken& aToken, SwDoc* pDoc)
+{
+    const std::pair<sal_uInt16, OUString> key(aToken.nPoolId, aToken.sCharStyleName);
+    std::map<std::pair<sal_uInt16, OUString>, SwCharFormat*>::const_iterator it = mCharFormats.find(key);
+    if (it != mCharFormats.end()) {
+        return it->second;
+    }
+
+    SwCharFormat* pCharFormat;
+    if( USHRT_MAX != aToken.nPoolId )
+        pCharFormat = pDoc->getIDocumentStylePoolAccess().GetCharFormatFromPool( aToken.nPoolId );
+    else
+        pCharFormat = pDoc->FindCharFormatByName( aToken.sCharStyleName);
+    mCharFormats[key] = pCharFormat;
+    return pCharFormat;
+}
+
 // Add parameter <_TOXSectNdIdx> and <_pDefaultPageDesc> in order to control,
 // which page description is used, no appropriate one is found.
 void
@@ -172,12 +190,12 @@ ToxTextGenerator::GenerateText(SwDoc* pDoc, const std::vector<SwTOXSortTabBase*>
         SvxTabStopItem aTStops( 0, 0, SVX_TAB_ADJUST_DEFAULT, RES_PARATR_TABSTOP );
         // create an enumerator
         // #i21237#
-        SwFormTokens aPattern = mToxForm.GetPattern(nLvl);
-        SwFormTokens::iterator aIt = aPattern.begin();
+        const SwFormTokens& rPattern = mToxForm.GetPattern(nLvl);
+        SwFormTokens::const_iterator aIt = rPattern.begin();
         // remove text from node
-        while(aIt != aPattern.end()) // #i21237#
+        while(aIt != rPattern.end()) // #i21237#
         {
-            SwFormToken aToken = *aIt; // #i21237#
+            const SwFormToken& aToken = *aIt; // #i21237#
             sal_Int32 nStartCharStyle = rText.getLength();
             switch( aToken.eTokenType )
             {
@@ -242,12 +260,7 @@ ToxTextGenerator::GenerateText(SwDoc* pDoc, const std::vector<SwTOXSortTabBase*>
 
             if ( !aToken.sCharStyleName.isEmpty() )
             {
-                SwCharFormat* pCharFormat;
-                if( USHRT_MAX != aToken.nPoolId )
-                    pCharFormat = pDoc->getIDocumentStylePoolAccess().GetCharFormatFromPool( aToken.nPoolId );
-                else
-                    pCharFormat = pDoc->FindCharFormatByName( aToken.sCharStyleName);
-
+                SwCharFormat* pCharFormat = GetCharFormatOfToken(aToken, pDoc);
                 if (pCharFormat)
                 {
                     SwFormatCharFormat aFormat( pCharFormat );
@@ -262,6 +275,8 @@ ToxTextGenerator::GenerateText(SwDoc* pDoc, const std::vector<SwTOXSortTabBase*>
         pTOXNd->SetAttr( aTStops );
     }
     mLinkProcessor->InsertLinkAttributes(*pTOXNd);
+    // the links belong to this node only
+    mLinkProcessor.reset(new ToxLinkProcessor());
 }
 
 /*static*/ std::shared_ptr<SfxItemSet>
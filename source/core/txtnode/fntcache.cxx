@@ -19,6 +19,7 @@
 
 #include <sal/config.h>
 
+#include <algorithm>
 #include <cstdlib>
 
 #include <i18nlangtag/mslangid.hxx>
@@ -93,6 +94,17 @@ long EvalGridWidthAdd( const SwTextGridItem *const pGrid, const SwDrawTextInfo &
 
 }
 
+#ifdef DBG_UTIL
+SwFntCache::~SwFntCache()
+{
+    SAL_INFO(
+        "sw.core",
+        "Global Font-Cache pFntCache; number of text measurements found: "
+            << m_nTextWidthHit
+            << "; number of text measurements done: " << m_nTextWidthMiss);
+}
+#endif
+
 void SwFntCache::Flush( )
 {
     if ( pLastFont )
@@ -109,6 +121,7 @@ SwFntObj::SwFntObj(const SwSubFont &rFont, const void *pOwn, SwViewShell const *
     , pScrFont(NULL)
     , pPrtFont(&aFont)
     , pPrinter(NULL)
+    , pTextWidths(NULL)
     , nGuessedLeading(USHRT_MAX)
     , nExtLeading(USHRT_MAX)
     , nScrAscent(0)
@@ -132,6 +145,7 @@ SwFntObj::~SwFntObj()
         delete pScrFont;
     if ( pPrtFont != &aFont )
         delete pPrtFont;
+    delete[] pTextWidths;
 }
 
 void SwFntObj::CreatePrtFont( const OutputDevice& rPrt )
@@ -154,6 +168,10 @@ void SwFntObj::CreatePrtFont( const OutputDevice& rPrt )
         pPrtFont = new vcl::Font( aFont );
         pPrtFont->SetSize( Size( nWidth, aFont.GetSize().Height() ) );
         pScrFont = NULL;
+
+        // the remembered widths belong to the old printer font
+        delete[] pTextWidths;
+        pTextWidths = NULL;
     }
 }
 
@@ -418,7 +436,7 @@ void SwFntObj::CreateScrFont( const SwViewShell& rSh, const OutputDevice& rOut )
         // After CreatePrtFont pPrtFont is the font which is actually used
         // by the reference device
         CreatePrtFont( *pPrt );
-        pPrinter = pPrt;
+        SetPrt( pPrt );
 
         // save old reference device font
         vcl::Font aOldPrtFnt( pPrt->GetFont() );
@@ -1406,8 +1424,7 @@ void SwFntObj::DrawText( SwDrawTextInfo &rInf )
                 if( !pPrtFont->IsSameInstance( pPrinter->GetFont() ) )
                     pPrinter->SetFont( *pPrtFont );
             }
-            pPrinter->GetTextArray( rInf.GetText(), pKernArray, rInf.GetIdx(),
-                                    rInf.GetLen() );
+            GetPrtTextArray( rInf, pKernArray, rInf.GetLen() );
         }
         else
         {
@@ -1899,7 +1916,7 @@ Size SwFntObj::GetTextSize( SwDrawTextInfo& rInf )
             rInf.GetOut().SetFont( *pScrFont );
         long nScrPos;
 
-        pPrinter->GetTextArray( rInf.GetText(), pKernArray, rInf.GetIdx(),nLn );
+        GetPrtTextArray( rInf, pKernArray, nLn );
         if( bCompress )
             rInf.SetKanaDiff( rInf.GetScriptInfo()->Compress( pKernArray,
                 rInf.GetIdx(), nLn, rInf.GetKanaComp(),
@@ -1970,6 +1987,12 @@ Size SwFntObj::GetTextSize( SwDrawTextInfo& rInf )
             aTextSize.Width() = pKernArray[ nLn - 1 ];
             delete[] pKernArray;
         }
+        else if ( pPrinter && pPrinter.get() == rInf.GetpOut() )
+        {
+            // formatting at the reference device
+            aTextSize.Width() = GetPrtTextWidth( rInf, nLn );
+            rInf.SetKanaDiff( 0 );
+        }
         else
         {
             aTextSize.Width() = rInf.GetOut().GetTextWidth( rInf.GetText(),
@@ -1991,6 +2014,120 @@ Size SwFntObj::GetTextSize( SwDrawTextInfo& rInf )
     return aTextSize;
 }
 
+void SwFntObj::SetPrt( OutputDevice* pPrt )
+{
+    if ( pPrinter.get() != pPrt )
+    {
+        // the remembered measurements belong to the old reference device
+        delete[] pTextWidths;
+        pTextWidths = NULL;
+        pPrinter = pPrt;
+    }
+}
+
+/// While a paragraph is reformatted (e.g. after every keystroke), the same
+/// portions are measured at the reference device again and again; remember
+/// the last measurements per font. The kerning is added by the callers.
+/// Returns NULL for portions which have to be measured in their context.
+SwTextWidthEntry* SwFntObj::GetTextWidthEntry( const SwDrawTextInfo& rInf,
+                                               const sal_Int32 nLn )
+{
+    const OUString& rText = rInf.GetText();
+    const sal_Int32 nIdx = rInf.GetIdx();
+
+    // complex text may be shaped depending on the text around the portion
+    if ( !pPrinter || !nLn || nIdx + nLn > rText.getLength() ||
+         ( rInf.GetFont() && SW_CTL == rInf.GetFont()->GetActual() ) )
+        return NULL;
+
+    const sal_Unicode* pStr = rText.getStr() + nIdx;
+    const sal_Int32 nHash = rtl_ustr_hashCode_WithLength( pStr, nLn );
+    if ( !pTextWidths )
+        pTextWidths = new SwTextWidthEntry[ TEXTWIDTH_SLOTS ];
+    SwTextWidthEntry& rEntry =
+        pTextWidths[ static_cast<sal_uInt32>(nHash) % TEXTWIDTH_SLOTS ];
+
+    if ( rEntry.nHash != nHash ||
+         rEntry.nLayoutMode != pPrinter->GetLayoutMode() ||
+         rEntry.eDigitLanguage != pPrinter->GetDigitLanguage() ||
+         rEntry.aText.getLength() != nLn ||
+         0 != rtl_ustr_reverseCompare_WithLength( rEntry.aText.getStr(), nLn,
+                                                  pStr, nLn ) )
+    {
+        // another text in this slot: forget its measurements
+        rEntry.aText = OUString( pStr, nLn );
+        rEntry.nHash = nHash;
+        rEntry.nLayoutMode = pPrinter->GetLayoutMode();
+        rEntry.eDigitLanguage = pPrinter->GetDigitLanguage();
+        rEntry.nWidth = -1;
+        rEntry.aKernArray.clear();
+        rEntry.nBreak = -2;
+    }
+    return &rEntry;
+}
+
+long SwFntObj::GetPrtTextWidth( SwDrawTextInfo& rInf, const sal_Int32 nLn )
+{
+    SwTextWidthEntry* pEntry = GetTextWidthEntry( rInf, nLn );
+    if ( !pEntry )
+        return rInf.GetOut().GetTextWidth( rInf.GetText(), rInf.GetIdx(), nLn,
+                                           rInf.GetVclCache() );
+#ifdef DBG_UTIL
+    pFntCache->CountTextWidth( pEntry->nWidth >= 0 );
+#endif
+    if ( pEntry->nWidth < 0 )
+        pEntry->nWidth = pPrinter->GetTextWidth( rInf.GetText(), rInf.GetIdx(),
+                                                 nLn, rInf.GetVclCache() );
+    return pEntry->nWidth;
+}
+
+/// GetTextArray at pPrinter, whose font has to be pPrtFont
+void SwFntObj::GetPrtTextArray( SwDrawTextInfo& rInf, long* pKernArray,
+                                const sal_Int32 nLn )
+{
+    SwTextWidthEntry* pEntry = GetTextWidthEntry( rInf, nLn );
+    if ( !pEntry )
+    {
+        pPrinter->GetTextArray( rInf.GetText(), pKernArray, rInf.GetIdx(), nLn );
+        return;
+    }
+#ifdef DBG_UTIL
+    pFntCache->CountTextWidth( !pEntry->aKernArray.empty() );
+#endif
+    if ( pEntry->aKernArray.empty() )
+    {
+        pEntry->aKernArray.resize( nLn );
+        pPrinter->GetTextArray( rInf.GetText(), &pEntry->aKernArray[0],
+                                rInf.GetIdx(), nLn );
+    }
+    std::copy( pEntry->aKernArray.begin(), pEntry->aKernArray.end(), pKernArray );
+}
+
+sal_Int32 SwFntObj::GetPrtTextBreak( SwDrawTextInfo& rInf, long nTextWidth,
+                                     const sal_Int32 nLn, long nKern )
+{
+    SwTextWidthEntry* pEntry = GetTextWidthEntry( rInf, nLn );
+    if ( !pEntry )
+        return rInf.GetOut().GetTextBreak( rInf.GetText(), nTextWidth,
+                                           rInf.GetIdx(), nLn, nKern,
+                                           rInf.GetVclCache() );
+    const bool bHit = pEntry->nBreak != -2 &&
+                      pEntry->nBreakWidth == nTextWidth &&
+                      pEntry->nBreakKern == nKern;
+#ifdef DBG_UTIL
+    pFntCache->CountTextWidth( bHit );
+#endif
+    if ( !bHit )
+    {
+        const sal_Int32 nBreak = pPrinter->GetTextBreak( rInf.GetText(),
+            nTextWidth, rInf.GetIdx(), nLn, nKern, rInf.GetVclCache() );
+        pEntry->nBreakWidth = nTextWidth;
+        pEntry->nBreakKern = nKern;
+        pEntry->nBreak = nBreak == -1 ? -1 : nBreak - rInf.GetIdx();
+    }
+    return pEntry->nBreak == -1 ? -1 : pEntry->nBreak + rInf.GetIdx();
+}
+
 sal_Int32 SwFntObj::GetCrsrOfst( SwDrawTextInfo &rInf )
 {
     long nSpaceAdd =       rInf.GetSpace() / SPACING_PRECISION_FACTOR;
@@ -2276,7 +2413,7 @@ SwFntAccess::SwFntAccess( const void* &rMagic,
             {
                 OSL_ENSURE( !pFntObj->pPrinter, "SwFntAccess: Printer Changed" );
                 pFntObj->CreatePrtFont( *pOut );
-                pFntObj->pPrinter = pOut;
+                pFntObj->SetPrt( pOut );
                 pFntObj->pScrFont = NULL;
                 pFntObj->nGuessedLeading = USHRT_MAX;
                 pFntObj->nExtLeading = USHRT_MAX;
@@ -2434,6 +2571,12 @@ sal_Int32 SwFont::GetTextBreak( SwDrawTextInfo& rInf, long nTextWidth )
                              nTmpIdx, nTmpLen, nKern, rInf.GetVclCache());
             *rInf.GetHyphPos() = (nHyphPos == -1) ? COMPLETE_STRING : nHyphPos;
         }
+        else if ( !bTextReplaced && SW_CTL != GetActual() &&
+                  pLastFont->GetPrt() == rInf.GetpOut() )
+        {
+            // formatting at the reference device
+            nTextBreak = pLastFont->GetPrtTextBreak( rInf, nTextWidth, nLn, nKern );
+        }
         else
             nTextBreak = rInf.GetOut().GetTextBreak( *pTmpText, nTextWidth,
                              nTmpIdx, nTmpLen, nKern, rInf.GetVclCache());
@@ -1072,12 +1072,24 @@ void SwTextNode::Update(
         {
             bool bAtLeastOneBookmarkMoved = false;
             bool bAtLeastOneExpandedBookmarkAtInsertionPosition = false;
-            // A text node already knows its marks via its SwIndexes.
+            // A text node already knows its marks via its SwIndexes. Only marks
+            // starting or ending at the insert position are of interest, and
+            // their indexes are next to rPos in the sorted list: don't look at
+            // all the others on every keystroke.
+            const SwIndex* pFirst = GetFirstIndex();
+            if (rPos.GetIdxReg() == this)
+            {
+                pFirst = &rPos;
+                while (pFirst->GetPrev() && pFirst->GetPrev()->GetIndex() == nChangePos)
+                    pFirst = pFirst->GetPrev();
+            }
             std::set<const sw::mark::IMark*> aSeenMarks;
             const SwIndex* next;
-            for (const SwIndex* pIndex = GetFirstIndex(); pIndex; pIndex = next )
+            for (const SwIndex* pIndex = pFirst; pIndex; pIndex = next )
             {
                 next = pIndex->GetNext();
+                if (pIndex->GetIndex() > nChangePos)
+                    break;
                 const sw::mark::IMark* pMark = pIndex->GetMark();
                 if (!pMark)
                     continue;
@@ -3357,8 +3369,8 @@ OUString SwTextNode::GetRedlineText( sal_Int32 nIdx, sal_Int32 nLen,
 {
     std::vector<sal_Int32> aRedlArr;
     const SwDoc* pDoc = GetDoc();
-    sal_uInt16 nRedlPos = pDoc->getIDocumentRedlineAccess().GetRedlinePos( *this, nsRedlineType_t::REDLINE_DELETE );
-    if( USHRT_MAX != nRedlPos )
+    SwRedlineTable::size_type nRedlPos = pDoc->getIDocumentRedlineAccess().GetRedlinePos( *this, nsRedlineType_t::REDLINE_DELETE );
+    if( SwRedlineTable::npos != nRedlPos )
     {
         // es existiert fuer den Node irgendein Redline-Delete-Object
         const sal_uLong nNdIdx = GetIndex();
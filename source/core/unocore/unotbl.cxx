@@ -20,6 +20,7 @@
 #include <list>
 #include <array>
 #include <utility>
+#include <unordered_map>
 #include <vector>
 #include <algorithm>
 
@@ -680,6 +681,12 @@ static void lcl_SetTableSeparators(const uno::Any& rVal, SwTable* pTable, SwTabl
     pDoc->SetTabCols(*pTable, aCols, aOldCols, pBox, bRow );
 }
 
+static void lcl_UpdateTableFields( SwFrameFormat* pTableFormat )
+{
+    SwTableFormulaUpdate aTableUpdate( SwTable::FindTable( pTableFormat ));
+    pTableFormat->GetDoc()->getIDocumentFieldsAccess().UpdateTableFields( &aTableUpdate );
+}
+
 static inline OUString lcl_getString( SwXCell &rCell )
 {
     // getString is a member function of the base class...
@@ -715,7 +722,7 @@ double sw_getValue( SwXCell &rCell )
 }
 
 /* non UNO function call to set value in SwXCell */
-void sw_setValue( SwXCell &rCell, double nVal )
+void sw_setValue( SwXCell &rCell, double nVal, bool bUpdateTableFields )
 {
     if(!rCell.IsValid())
         return;
@@ -744,8 +751,8 @@ void sw_setValue( SwXCell &rCell, double nVal )
     aSet.Put(aVal);
     pDoc->SetTableBoxFormulaAttrs( *rCell.pBox, aSet );
     // update table
-    SwTableFormulaUpdate aTableUpdate( SwTable::FindTable( rCell.GetFrameFormat() ));
-    pDoc->getIDocumentFieldsAccess().UpdateTableFields( &aTableUpdate );
+    if (bUpdateTableFields)
+        lcl_UpdateTableFields( rCell.GetFrameFormat() );
 }
 
 TYPEINIT1(SwXCell, SwClient);
@@ -925,7 +932,7 @@ double SwXCell::getValue() throw( uno::RuntimeException, std::exception )
 void SwXCell::setValue(double rValue) throw( uno::RuntimeException, std::exception )
 {
     SolarMutexGuard aGuard;
-    sw_setValue( *this, rValue );
+    sw_setValue( *this, rValue, true );
 }
 
 table::CellContentType SwXCell::getType() throw( uno::RuntimeException, std::exception )
@@ -1140,7 +1147,7 @@ void SwXCell::SwClientNotify(const SwModify& rModify, const SfxHint& rHint)
     if(typeid(FindUnoInstanceHint<SwTableBox, SwXCell>) == typeid(rHint))
     {
         auto* pFindHint(static_cast<const FindUnoInstanceHint<SwTableBox, SwXCell>* >(&rHint));
-        if(!pFindHint->m_pCore && pFindHint->m_pCore == GetTableBox())
+        if(!pFindHint->m_pResult && pFindHint->m_pCore == GetTableBox())
             pFindHint->m_pResult = this;
     }
     else
@@ -3156,13 +3163,54 @@ SwXCellRange::SwXCellRange(std::shared_ptr<SwUnoCrsr> pCrsr, SwFrameFormat& rFra
 std::vector< uno::Reference< table::XCell > > SwXCellRange::getCells()
 {
     SwFrameFormat* const pFormat = GetFrameFormat();
+    SwTable* const pTable = SwTable::FindTable(pFormat);
     const sal_Int32 nRowCount(getRowCount());
     const sal_Int32 nColCount(getColumnCount());
     std::vector< uno::Reference< table::XCell > > vResult;
     vResult.reserve(static_cast<size_t>(nRowCount)*static_cast<size_t>(nColCount));
+    if(!pTable || pTable->IsTableComplex())
+    {
+        for(sal_Int32 nRow = 0; nRow < nRowCount; ++nRow)
+            for(sal_Int32 nCol = 0; nCol < nColCount; ++nCol)
+                vResult.push_back(uno::Reference< table::XCell >(lcl_CreateXCell(pFormat, aRgDesc.nLeft + nCol, aRgDesc.nTop + nRow)));
+        return vResult;
+    }
+    // In a simple table the cell at (nCol, nRow) is just box nCol of line
+    // nRow, so walk the lines instead of building and parsing a cell name
+    // per cell. Likewise, collect the existing cell objects in one go:
+    // SwXCell::CreateXCell() asks every client of the table format for
+    // each single cell, which is quadratic for large ranges.
+    std::unordered_map<const SwTableBox*, SwXCell*> aExistingCells;
+    SwIterator<SwXCell, SwFormat> aIter(*pFormat);
+    for(SwXCell* pCell = aIter.First(); pCell; pCell = aIter.Next())
+        if(pCell->GetTableBox())
+            aExistingCells.insert(std::make_pair(pCell->GetTableBox(), pCell));
+    const SwTableLines& rLines = pTable->GetTabLines();
+    const SwTableSortBoxes& rSortBoxes = pTable->GetTabSortBoxes();
     for(sal_Int32 nRow = 0; nRow < nRowCount; ++nRow)
+    {
+        const size_t nLine = static_cast<size_t>(aRgDesc.nTop + nRow);
+        const SwTableBoxes* pBoxes = nLine < rLines.size() ? &rLines[nLine]->GetTabBoxes() : nullptr;
         for(sal_Int32 nCol = 0; nCol < nColCount; ++nCol)
-            vResult.push_back(uno::Reference< table::XCell >(lcl_CreateXCell(pFormat, aRgDesc.nLeft + nCol, aRgDesc.nTop + nRow)));
+        {
+            const size_t nBox = static_cast<size_t>(aRgDesc.nLeft + nCol);
+            SwTableBox* pBox = (pBoxes && nBox < pBoxes->size()) ? (*pBoxes)[nBox] : nullptr;
+            SwXCell* pXCell = nullptr;
+            if(pBox)
+            {
+                auto pExisting(aExistingCells.find(pBox));
+                if(pExisting != aExistingCells.end())
+                    pXCell = pExisting->second;
+                else
+                {
+                    SwTableSortBoxes::const_iterator pSortBox(rSortBoxes.find(pBox));
+                    if(pSortBox != rSortBoxes.end())
+                        pXCell = new SwXCell(pFormat, pBox, pSortBox - rSortBoxes.begin());
+                }
+            }
+            vResult.push_back(uno::Reference< table::XCell >(pXCell));
+        }
+    }
     return vResult;
 }
 
@@ -3520,17 +3568,14 @@ void SwXCellRange::GetDataSequence(
         double fNan;
         ::rtl::math::setNan( & fNan );
 
-        uno::Reference< table::XCell > xCellRef;
+        auto vCells(getCells());
+        auto pCurrentCell(vCells.begin());
         for(sal_Int32 nRow = 0; nRow < nRowCount; ++nRow)
         {
             for(sal_Int32 nCol = 0; nCol < nColCount; ++nCol)
             {
-                SwXCell * pXCell = lcl_CreateXCell(pFormat,
-                                    aRgDesc.nLeft + nCol,
-                                    aRgDesc.nTop + nRow);
-                //! keep (additional) reference to object to prevent implicit destruction
-                //! in following UNO calls (when object will get referenced)
-                xCellRef = pXCell;
+                SwXCell * pXCell = static_cast<SwXCell*>(pCurrentCell->get());
+                ++pCurrentCell;
                 SwTableBox * pBox = pXCell ? pXCell->GetTableBox() : 0;
                 if(!pBox)
                 {
@@ -3662,6 +3707,8 @@ void SAL_CALL SwXCellRange::setDataArray(const uno::Sequence< uno::Sequence< uno
         return;
     if(rArray.getLength() != nRowCount)
         throw uno::RuntimeException("Row count mismatch. expected: " + OUString::number(nRowCount) + " got: " + OUString::number(rArray.getLength()), static_cast<cppu::OWeakObject*>(this));
+    // one layout and one table formula update for the whole range
+    UnoActionContext aAction(pFormat->GetDoc());
     auto vCells(getCells());
     auto pCurrentCell(vCells.begin());
     for(const auto& rColSeq : rArray)
@@ -3676,12 +3723,13 @@ void SAL_CALL SwXCellRange::setDataArray(const uno::Sequence< uno::Sequence< uno
             if(aValue.isExtractableTo(cppu::UnoType<OUString>::get()))
                 sw_setString(*pCell, aValue.get<OUString>());
             else if(aValue.isExtractableTo(cppu::UnoType<double>::get()))
-                sw_setValue(*pCell, aValue.get<double>());
+                sw_setValue(*pCell, aValue.get<double>(), false);
             else
                 sw_setString(*pCell, OUString(), true);
             ++pCurrentCell;
         }
     }
+    lcl_UpdateTableFields(pFormat);
 }
 
 uno::Sequence< uno::Sequence< double > > SwXCellRange::getData() throw( uno::RuntimeException, std::exception )
@@ -3726,9 +3774,11 @@ void SwXCellRange::setData(const uno::Sequence< uno::Sequence< double > >& rData
             nColCount-1, nRowCount-1), uno::UNO_QUERY);
         return xDataRange->setData(rData);
     }
-    lcl_EnsureCoreConnected(GetFrameFormat(), static_cast<cppu::OWeakObject*>(this));
+    SwFrameFormat* pFormat = lcl_EnsureCoreConnected(GetFrameFormat(), static_cast<cppu::OWeakObject*>(this));
     if(rData.getLength() != nRowCount)
         throw uno::RuntimeException("Row count mismatch. expected: " + OUString::number(nRowCount) + " got: " + OUString::number(rData.getLength()), static_cast<cppu::OWeakObject*>(this));
+    // one layout and one table formula update for the whole range
+    UnoActionContext aAction(pFormat->GetDoc());
     auto vCells(getCells());
     auto pCurrentCell(vCells.begin());
     for(const auto& rRow : rData)
@@ -3737,10 +3787,14 @@ void SwXCellRange::setData(const uno::Sequence< uno::Sequence< double > >& rData
             throw uno::RuntimeException("Column count mismatch. expected: " + OUString::number(nColCount) + " got: " + OUString::number(rRow.getLength()), static_cast<cppu::OWeakObject*>(this));
         for(const auto& rValue : rRow)
         {
-            uno::Reference<table::XCell>(*pCurrentCell, uno::UNO_QUERY)->setValue(rValue);
+            auto pCell(static_cast<SwXCell*>(pCurrentCell->get()));
+            if(!pCell)
+                throw uno::RuntimeException("Box for cell missing", static_cast<cppu::OWeakObject*>(this));
+            sw_setValue(*pCell, rValue, false);
             ++pCurrentCell;
         }
     }
+    lcl_UpdateTableFields(pFormat);
 }
 
 std::tuple<sal_uInt32, sal_uInt32, sal_uInt32, sal_uInt32> SwXCellRange::getLabelCoordinates(bool bRow)
@@ -0,0 +1,73 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <tilecache.hxx>
+#include <sal/log.hxx>
+
+SwTileCache::SwTileCache()
+    : mnLockCount(0)
+    , mnHits(0)
+    , mnMisses(0)
+{
+}
+
+SwTileCache::~SwTileCache()
+{
+    SAL_INFO("sw.tiled", "tile cache: " << mnHits << " hits, " << mnMisses << " misses");
+}
+
+bool SwTileCache::Get(const Rectangle& rArea, const Size& rOutputSize, Bitmap& rBitmap)
+{
+    for (std::list<Tile>::iterator it = maTiles.begin(); it != maTiles.end(); ++it)
+    {
+        if (it->maArea == rArea && it->maOutputSize == rOutputSize)
+        {
+            rBitmap = it->maBitmap;
+            // move to the end, it's the most recently used one now
+            maTiles.splice(maTiles.end(), maTiles, it);
+            ++mnHits;
+            return true;
+        }
+    }
+    ++mnMisses;
+    return false;
+}
+
+void SwTileCache::Put(const Rectangle& rArea, const Size& rOutputSize, const Bitmap& rBitmap)
+{
+    Tile aTile;
+    aTile.maArea = rArea;
+    aTile.maOutputSize = rOutputSize;
+    aTile.maBitmap = rBitmap;
+    maTiles.push_back(aTile);
+    if (maTiles.size() > MAX_TILES)
+        maTiles.pop_front();
+}
+
+void SwTileCache::Invalidate(const Rectangle* pArea)
+{
+    if (mnLockCount)
+        return;
+
+    if (!pArea)
+    {
+        maTiles.clear();
+        return;
+    }
+
+    for (std::list<Tile>::iterator it = maTiles.begin(); it != maTiles.end();)
+    {
+        if (it->maArea.IsOver(*pArea))
+            it = maTiles.erase(it);
+        else
+            ++it;
+    }
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
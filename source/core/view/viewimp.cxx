@@ -33,6 +33,7 @@
 #include <accmap.hxx>
 
 #include <pagepreviewlayout.hxx>
+#include <tilecache.hxx>
 #include <comcore.hrc>
 #include <svx/svdundo.hxx>
 #include <IDocumentLayoutAccess.hxx>
@@ -92,9 +93,12 @@ SwViewShellImp::SwViewShellImp( SwViewShell *pParent ) :
     pSdrPageView( 0 ),
     pFirstVisPage( 0 ),
     pRegion( 0 ),
+    pInvalidRegion( 0 ),
+    nInvalidBudget( 32 ),
     pLayAct( 0 ),
     pIdleAct( 0 ),
     pAccMap( 0 ),
+    pTileCache( 0 ),
     pSdrObjCached(NULL),
     bFirstPageInvalid( true ),
     bResetHdlHiddenPaint( false ),
@@ -110,6 +114,8 @@ SwViewShellImp::~SwViewShellImp()
 {
     delete pAccMap;
 
+    delete pTileCache;
+
     // OD 12.12.2002 #103492#
     delete mpPgPreviewLayout;
 
@@ -120,11 +126,19 @@ SwViewShellImp::~SwViewShellImp()
     delete pDrawView;
 
     DelRegion();
+    delete pInvalidRegion;
 
     OSL_ENSURE( !pLayAct, "Have action for the rest of your life." );
     OSL_ENSURE( !pIdleAct,"Be idle for the rest of your life." );
 }
 
+SwTileCache& SwViewShellImp::GetTileCache()
+{
+    if ( !pTileCache )
+        pTileCache = new SwTileCache;
+    return *pTileCache;
+}
+
 void SwViewShellImp::DelRegion()
 {
     DELETEZ(pRegion);
@@ -148,6 +162,46 @@ bool SwViewShellImp::AddPaintRect( const SwRect &rRect )
     return false;
 }
 
+void SwViewShellImp::AddInvalidRect( const SwRect &rRect )
+{
+    if ( !pInvalidRegion )
+    {
+        pInvalidRegion = new SwRegionRects( pSh->GetLayout()->Frm() );
+        pInvalidRegion->clear();
+    }
+    (*pInvalidRegion) += rRect;
+}
+
+void SwViewShellImp::FlushInvalidRects()
+{
+    if ( !pInvalidRegion )
+        return;
+
+    // Detach first: invalidating may end up in a new action, collecting again.
+    SwRegionRects *pRects = pInvalidRegion;
+    pInvalidRegion = 0;
+
+    // Drop duplicates and contained rectangles, merge neighbours.
+    pRects->Compress();
+    if ( pRects->size() > nInvalidBudget )
+    {
+        // Too many pieces: a single larger invalidation is cheaper for the
+        // client than lots of small ones.
+        SwRect aUnion( (*pRects)[0] );
+        for ( size_t i = 1; i < pRects->size(); ++i )
+            aUnion.Union( (*pRects)[i] );
+        pRects->clear();
+        pRects->push_back( aUnion );
+    }
+
+    if ( pSh->GetWin() )
+    {
+        for ( size_t i = 0; i < pRects->size(); ++i )
+            pSh->GetWin()->Invalidate( (*pRects)[i].SVRect() );
+    }
+    delete pRects;
+}
+
 void SwViewShellImp::CheckWaitCrsr()
 {
     if ( pLayAct )
@@ -76,6 +76,7 @@
 #include <PostItMgr.hxx>
 #include <vcl/dibtools.hxx>
 #include <vcl/virdev.hxx>
+#include <tilecache.hxx>
 #include <vcl/svapp.hxx>
 #include <svx/sdrpaintwindow.hxx>
 #include <LibreOfficeKit/LibreOfficeKitEnums.h>
@@ -438,6 +439,7 @@ void SwViewShell::ImplEndAction( const bool bIdleEnd )
     //adjust the scrollbars correctly
     --mnStartAction;
     UISizeNotify();
+    Imp()->FlushInvalidRects();
     ++mnStartAction;
 
     if( Imp()->IsAccessible() )
@@ -541,7 +543,11 @@ void SwViewShell::InvalidateWindows( const SwRect &rRect )
                 if ( rSh.IsPreview() )
                     ::RepaintPagePreview( &rSh, rRect );
                 // In case of tiled rendering, invalidation is wanted even if
-                // the rectangle is outside the visual area.
+                // the rectangle is outside the visual area. Every invalidation
+                // ends up as a callback to the client, so collect them till
+                // the end of the action, and send them merged.
+                else if ( rSh.isTiledRendering() && rSh.ActionPend() )
+                    rSh.Imp()->AddInvalidRect( rRect );
                 else if ( rSh.VisArea().IsOver( rRect ) || rSh.isTiledRendering() )
                     rSh.GetWin()->Invalidate( rRect.SVRect() );
             }
@@ -1588,6 +1594,16 @@ bool SwViewShell::CheckInvalidForPaint( const SwRect &rRect )
         ++mnStartAction;
         aAction.Action();
         --mnStartAction;
+        if ( !mnStartAction )
+            Imp()->FlushInvalidRects();
+
+        // Changes inside rRect don't invalidate the window below, as rRect
+        // is painted right after this anyway: drop the tiles cached for it.
+        if ( Imp()->HasTileCache() )
+        {
+            const Rectangle aRect( rRect.SVRect() );
+            Imp()->GetTileCache().Invalidate( &aRect );
+        }
 
         SwRegionRects *pRegion = Imp()->GetRegion();
         if ( pRegion && aAction.IsBrowseActionStop() )
@@ -1788,6 +1804,22 @@ void SwViewShell::Paint(vcl::RenderContext& rRenderContext, const Rectangle &rRe
     }
 }
 
+/// Sets up rDevice so that the tile at tilePosX/tilePosY is painted over its whole area.
+static void lcl_SetTileMapMode(VirtualDevice &rDevice, int contextWidth, int contextHeight, long tilePosX, long tilePosY, long tileWidth, long tileHeight)
+{
+    MapMode aMapMode(rDevice.GetMapMode());
+    aMapMode.SetMapUnit(MAP_TWIP);
+    aMapMode.SetOrigin(Point(-tilePosX, -tilePosY));
+
+    // Scaling. Must convert from pixels to twips. We know
+    // that VirtualDevices use a DPI of 96.
+    Fraction scaleX = Fraction(contextWidth, 96) * Fraction(1440L) / Fraction(tileWidth);
+    Fraction scaleY = Fraction(contextHeight, 96) * Fraction(1440L) / Fraction(tileHeight);
+    aMapMode.SetScaleX(scaleX);
+    aMapMode.SetScaleY(scaleY);
+    rDevice.SetMapMode(aMapMode);
+}
+
 void SwViewShell::PaintTile(VirtualDevice &rDevice, int contextWidth, int contextHeight, int tilePosX, int tilePosY, long tileWidth, long tileHeight)
 {
     // SwViewShell's output device setup
@@ -1803,17 +1835,7 @@ void SwViewShell::PaintTile(VirtualDevice &rDevice, int contextWidth, int contex
     rDevice.SetOutputSizePixel(Size(contextWidth, contextHeight));
 
     // setup the output device to draw the tile
-    MapMode aMapMode(rDevice.GetMapMode());
-    aMapMode.SetMapUnit(MAP_TWIP);
-    aMapMode.SetOrigin(Point(-tilePosX, -tilePosY));
-
-    // Scaling. Must convert from pixels to twips. We know
-    // that VirtualDevices use a DPI of 96.
-    Fraction scaleX = Fraction(contextWidth, 96) * Fraction(1440L) / Fraction(tileWidth);
-    Fraction scaleY = Fraction(contextHeight, 96) * Fraction(1440L) / Fraction(tileHeight);
-    aMapMode.SetScaleX(scaleX);
-    aMapMode.SetScaleY(scaleY);
-    rDevice.SetMapMode(aMapMode);
+    lcl_SetTileMapMode(rDevice, contextWidth, contextHeight, tilePosX, tilePosY, tileWidth, tileHeight);
 
     // Update this device in DrawLayer
     if (Imp()->GetDrawView())
@@ -1831,13 +1853,38 @@ void SwViewShell::PaintTile(VirtualDevice &rDevice, int contextWidth, int contex
     // tiledrendering app, or the gtktiledviewer) -- although ultimately we
     // probably want to fix things so that the SwView's area doesn't affect
     // tiled rendering?
+    // This invalidates the window, but changes nothing in the document:
+    // don't let it throw away the cached tiles.
+    SwTileCache& rTileCache = Imp()->GetTileCache();
+    rTileCache.Lock();
     VisPortChgd(SwRect(aOutRect));
+    rTileCache.Unlock();
 
     // Invoke SwLayAction if layout is not yet ready.
+    // This has to happen even if the tile is cached: if it formats anything,
+    // the cached tiles of the area are dropped.
     CheckInvalidForPaint(aOutRect);
 
-    // draw - works in logic coordinates
-    Paint(rDevice, aOutRect);
+    const Rectangle aTileRect(Point(tilePosX, tilePosY), Size(tileWidth, tileHeight));
+    const Size aOutputSize(contextWidth, contextHeight);
+    Bitmap aTile;
+    if (rTileCache.Get(aTileRect, aOutputSize, aTile))
+    {
+        rDevice.Push(PushFlags::MAPMODE);
+        rDevice.SetMapMode(MapMode(MAP_PIXEL));
+        rDevice.DrawBitmap(Point(0, 0), aTile);
+        rDevice.Pop();
+    }
+    else
+    {
+        // draw - works in logic coordinates
+        Paint(rDevice, aOutRect);
+
+        rDevice.Push(PushFlags::MAPMODE);
+        rDevice.SetMapMode(MapMode(MAP_PIXEL));
+        rTileCache.Put(aTileRect, aOutputSize, rDevice.GetBitmap(Point(0, 0), aOutputSize));
+        rDevice.Pop();
+    }
 
     // Remove this device in DrawLayer
     if (Imp()->GetDrawView())
@@ -1851,6 +1898,159 @@ void SwViewShell::PaintTile(VirtualDevice &rDevice, int contextWidth, int contex
     setTiledRendering(bTiledRendering);
 }
 
+void SwViewShell::PaintTiles(const std::vector<VirtualDevice*>& rDevices, const std::vector<Point>& rTilePositions,
+                             int contextWidth, int contextHeight, long tileWidth, long tileHeight)
+{
+    assert(rDevices.size() == rTilePositions.size());
+    if (rDevices.empty())
+        return;
+
+    OutputDevice *pSaveOut = mpOut;
+    bool bTiledRendering = isTiledRendering();
+    setTiledRendering(true);
+    mbInLibreOfficeKitCallback = true;
+
+    const Size aOutputSize(contextWidth, contextHeight);
+    const Size aTileSize(tileWidth, tileHeight);
+    Rectangle aArea;
+    for (const Point& rPos : rTilePositions)
+        aArea.Union(Rectangle(rPos, aTileSize));
+
+    // Output device setup as in PaintTile(), the first device stands in for
+    // all of them until we know what has to be painted.
+    VirtualDevice& rFirst = *rDevices.front();
+    rFirst.SetOutputSizePixel(aOutputSize);
+    lcl_SetTileMapMode(rFirst, contextWidth, contextHeight, rTilePositions.front().X(), rTilePositions.front().Y(), tileWidth, tileHeight);
+    mpOut = &rFirst;
+    if (Imp()->GetDrawView())
+        Imp()->GetDrawView()->AddWindowToPaintView(&rFirst);
+
+    // Make the whole requested area visible and valid at once, see PaintTile().
+    // If anything gets formatted, the cached tiles of the area are dropped.
+    SwTileCache& rTileCache = Imp()->GetTileCache();
+    rTileCache.Lock();
+    VisPortChgd(SwRect(aArea));
+    rTileCache.Unlock();
+    CheckInvalidForPaint(aArea);
+
+    if (Imp()->GetDrawView())
+        Imp()->GetDrawView()->DeleteWindowFromPaintView(&rFirst);
+
+    // Serve what we can from the cache, collect the rest.
+    std::vector<size_t> aMissing;
+    Rectangle aMissingArea;
+    for (size_t i = 0; i < rDevices.size(); ++i)
+    {
+        VirtualDevice& rDevice = *rDevices[i];
+        const Point& rPos = rTilePositions[i];
+        rDevice.SetOutputSizePixel(aOutputSize);
+        lcl_SetTileMapMode(rDevice, contextWidth, contextHeight, rPos.X(), rPos.Y(), tileWidth, tileHeight);
+
+        Bitmap aTile;
+        if (rTileCache.Get(Rectangle(rPos, aTileSize), aOutputSize, aTile))
+        {
+            rDevice.Push(PushFlags::MAPMODE);
+            rDevice.SetMapMode(MapMode(MAP_PIXEL));
+            rDevice.DrawBitmap(Point(0, 0), aTile);
+            rDevice.Pop();
+        }
+        else
+        {
+            aMissing.push_back(i);
+            aMissingArea.Union(Rectangle(rPos, aTileSize));
+        }
+    }
+
+    if (!aMissing.empty())
+    {
+        // Tiles are on a grid, so the missing ones usually form a block: paint
+        // that in one go, and cut the tiles out of it. Scattered tiles are
+        // painted one by one, so we don't paint lots of area nobody asked for.
+        const long nAtlasWidth = aMissingArea.GetWidth() * contextWidth / tileWidth;
+        const long nAtlasHeight = aMissingArea.GetHeight() * contextHeight / tileHeight;
+        const bool bAtlas = aMissing.size() > 1 &&
+            nAtlasWidth * nAtlasHeight <= 2 * long(aMissing.size()) * contextWidth * contextHeight;
+
+        VclPtr<VirtualDevice> pAtlas;
+        if (bAtlas)
+        {
+            pAtlas = VclPtr<VirtualDevice>::Create();
+            pAtlas->SetOutputSizePixel(Size(nAtlasWidth, nAtlasHeight));
+            lcl_SetTileMapMode(*pAtlas, contextWidth, contextHeight, aMissingArea.Left(), aMissingArea.Top(), tileWidth, tileHeight);
+            mpOut = pAtlas.get();
+            if (Imp()->GetDrawView())
+                Imp()->GetDrawView()->AddWindowToPaintView(pAtlas.get());
+            Paint(*pAtlas, aMissingArea);
+            if (Imp()->GetDrawView())
+                Imp()->GetDrawView()->DeleteWindowFromPaintView(pAtlas.get());
+            pAtlas->SetMapMode(MapMode(MAP_PIXEL));
+        }
+
+        for (size_t i : aMissing)
+        {
+            VirtualDevice& rDevice = *rDevices[i];
+            const Point& rPos = rTilePositions[i];
+            Bitmap aTile;
+            if (bAtlas)
+            {
+                const Point aPixelPos((rPos.X() - aMissingArea.Left()) * contextWidth / tileWidth,
+                                      (rPos.Y() - aMissingArea.Top()) * contextHeight / tileHeight);
+                aTile = pAtlas->GetBitmap(aPixelPos, aOutputSize);
+                rDevice.Push(PushFlags::MAPMODE);
+                rDevice.SetMapMode(MapMode(MAP_PIXEL));
+                rDevice.DrawBitmap(Point(0, 0), aTile);
+                rDevice.Pop();
+            }
+            else
+            {
+                mpOut = &rDevice;
+                if (Imp()->GetDrawView())
+                    Imp()->GetDrawView()->AddWindowToPaintView(&rDevice);
+                Paint(rDevice, Rectangle(rPos, rDevice.PixelToLogic(aOutputSize)));
+                if (Imp()->GetDrawView())
+                    Imp()->GetDrawView()->DeleteWindowFromPaintView(&rDevice);
+
+                rDevice.Push(PushFlags::MAPMODE);
+                rDevice.SetMapMode(MapMode(MAP_PIXEL));
+                aTile = rDevice.GetBitmap(Point(0, 0), aOutputSize);
+                rDevice.Pop();
+            }
+            rTileCache.Put(Rectangle(rPos, aTileSize), aOutputSize, aTile);
+        }
+        pAtlas.disposeAndClear();
+    }
+
+    mpOut = pSaveOut;
+    mbInLibreOfficeKitCallback = false;
+    setTiledRendering(bTiledRendering);
+}
+
+void SwViewShell::SetInvalidationBudget(sal_uInt16 nBudget)
+{
+    Imp()->SetInvalidBudget(nBudget);
+}
+
+sal_uInt16 SwViewShell::GetInvalidationBudget() const
+{
+    return mpImp->GetInvalidBudget();
+}
+
+void SwViewShell::InvalidateTileCache(const Rectangle* pRect)
+{
+    if (Imp()->HasTileCache())
+        Imp()->GetTileCache().Invalidate(pRect);
+}
+
+sal_uInt32 SwViewShell::GetTileCacheHits() const
+{
+    return mpImp->HasTileCache() ? mpImp->GetTileCache().GetHits() : 0;
+}
+
+sal_uInt32 SwViewShell::GetTileCacheMisses() const
+{
+    return mpImp->HasTileCache() ? mpImp->GetTileCache().GetMisses() : 0;
+}
+
 void SwViewShell::SetBrowseBorder( const Size& rNew )
 {
     if( rNew != maBrowseBorder )
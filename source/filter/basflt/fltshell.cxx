@@ -159,7 +159,9 @@ bool SwFltStackEntry::MakeRegion(SwDoc* pDoc, SwPaM& rRegion, bool bCheck) const
 }
 
 SwFltControlStack::SwFltControlStack(SwDoc* pDo, sal_uLong nFieldFl)
-    : nFieldFlags(nFieldFl),bHasSdOD(true), bSdODChecked(false), pDoc(pDo), bIsEndStack(false)
+    : maClosedNode(pDo->GetNodes().GetEndOfContent())
+    , mbClosedInOneNode(true)
+    , nFieldFlags(nFieldFl),bHasSdOD(true), bSdODChecked(false), pDoc(pDo), bIsEndStack(false)
 {
 }
 
@@ -207,6 +209,100 @@ void SwFltControlStack::MoveAttrs( const SwPosition& rPos )
     }
 }
 
+namespace
+{
+    // key of an open entry in the index: only bookmarks and annotation
+    // marks are closed by handle
+    long lcl_GetHandle(const SfxPoolItem& rAttr)
+    {
+        switch (rAttr.Which())
+        {
+            case RES_FLTR_BOOKMARK:
+                return static_cast<const SwFltBookmark&>(rAttr).GetHandle();
+            case RES_FLTR_ANNOTATIONMARK:
+                return static_cast<const CntUInt16Item&>(rAttr).GetValue();
+            default:
+                return 0;
+        }
+    }
+}
+
+void SwFltControlStack::AddEntry(SwFltStackEntry* pEntry)
+{
+    const sal_uInt16 nWhich = pEntry->pAttr->Which();
+    maEntries.push_back(pEntry);
+    ++maWhichCounts[nWhich];
+    if (pEntry->bOpen)
+        maOpenEntries.insert(OpenEntries::value_type(
+            OpenKey(nWhich, lcl_GetHandle(*pEntry->pAttr)), pEntry));
+}
+
+void SwFltControlStack::EraseOpenEntry(SwFltStackEntry& rEntry)
+{
+    std::pair<OpenEntries::iterator, OpenEntries::iterator> aRange =
+        maOpenEntries.equal_range(
+            OpenKey(rEntry.pAttr->Which(), lcl_GetHandle(*rEntry.pAttr)));
+    for (OpenEntries::iterator aI = aRange.first; aI != aRange.second; ++aI)
+    {
+        if (aI->second == &rEntry)
+        {
+            maOpenEntries.erase(aI);
+            return;
+        }
+    }
+    OSL_FAIL("open entry missing from the index");
+}
+
+SwFltControlStack::myEIter SwFltControlStack::EraseEntry(myEIter aElement)
+{
+    const sal_uInt16 nWhich = aElement->pAttr->Which();
+    if (aElement->bOpen)
+        EraseOpenEntry(*aElement);
+    std::map<sal_uInt16, size_t>::iterator aCount = maWhichCounts.find(nWhich);
+    if (aCount != maWhichCounts.end() && !--aCount->second)
+        maWhichCounts.erase(aCount);
+    return maEntries.erase(aElement);
+}
+
+// Set the end of an open entry, which must already be removed from the
+// index of open entries.
+void SwFltControlStack::CloseEntry(SwFltStackEntry& rEntry,
+    const SwPosition& rPos, bool consumedByField)
+{
+    rEntry.bConsumedByField = consumedByField;
+    rEntry.SetEndPos(rPos);
+    rEntry.SetEndCP(GetCurrAttrCP());
+
+    if (maEntries.size() - maOpenEntries.size() == 1)
+    {
+        // the only closed entry on the stack
+        maClosedNode = rEntry.m_aPtPos.m_nNode;
+        mbClosedInOneNode = true;
+    }
+    else if (maClosedNode != rEntry.m_aPtPos.m_nNode)
+        mbClosedInOneNode = false;
+}
+
+bool SwFltControlStack::HasOpenEntry(sal_uInt16 nWhich) const
+{
+    OpenEntries::const_iterator aI =
+        maOpenEntries.lower_bound(OpenKey(nWhich, LONG_MIN));
+    return aI != maOpenEntries.end() && aI->first.first == nWhich;
+}
+
+// Would SetAttr() at rFltPos have to apply closed entries to the document?
+bool SwFltControlStack::NeedsFlush(const SwFltPosition& rFltPos,
+    bool bTstEnde) const
+{
+    if (maEntries.size() == maOpenEntries.size())
+        return false;
+    if (!bTstEnde)
+        return true;
+    if (bIsEndStack)
+        return false;
+    return !mbClosedInOneNode || maClosedNode != rFltPos.m_nNode;
+}
+
 void SwFltControlStack::MarkAllAttrsOld()
 {
     size_t nCnt = maEntries.size();
@@ -244,12 +340,14 @@ void SwFltControlStack::NewAttr(const SwPosition& rPos, const SfxPoolItem& rAttr
         //to the stack
         pExtendCandidate->SetEndPos(rPos);
         pExtendCandidate->bOpen=true;
+        maOpenEntries.insert(OpenEntries::value_type(
+            OpenKey(nWhich, lcl_GetHandle(rAttr)), pExtendCandidate));
     }
     else
     {
         SwFltStackEntry *pTmp = new SwFltStackEntry(rPos, rAttr.Clone() );
         pTmp->SetStartCP(GetCurrAttrCP());
-        maEntries.push_back(pTmp);
+        AddEntry(pTmp);
     }
 }
 
@@ -259,7 +357,7 @@ void SwFltControlStack::DeleteAndDestroy(Entries::size_type nCnt)
     if (nCnt < maEntries.size())
     {
         myEIter aElement = maEntries.begin() + nCnt;
-        maEntries.erase(aElement);
+        EraseEntry(aElement);
     }
     //Clear the para end position recorded in reader intermittently for the least impact on loading performance
     //Because the attributes handled based on the unit of para
@@ -300,6 +398,11 @@ void SwFltControlStack::KillUnlockedAttrs(const SwPosition& rPos)
 {
     SwFltPosition aFltPos(rPos);
 
+    // only closed entries ending at rPos are candidates
+    if (maEntries.size() == maOpenEntries.size() ||
+        (mbClosedInOneNode && maClosedNode != aFltPos.m_nNode))
+        return;
+
     size_t nCnt = maEntries.size();
     while( nCnt )
     {
@@ -331,6 +434,54 @@ SwFltStackEntry* SwFltControlStack::SetAttr(const SwPosition& rPos,
         (RES_FLTRATTR_BEGIN <= nAttrId && RES_FLTRATTR_END > nAttrId),
         "Wrong id for attribute");
 
+    if (!NeedsFlush(aFltPos, bTstEnde))
+    {
+        // Nothing to apply to the document, only the matching open
+        // attributes are to be closed: find them through the index instead
+        // of walking the whole stack.
+        SwFltStackEntry* pLast = maEntries.empty() ? NULL : &maEntries.back();
+        if (pLast && !pLast->bOpen && bTstEnde && !bIsEndStack &&
+            nAttrId == pLast->pAttr->Which() &&
+            pLast->m_aPtPos.m_nNode.GetIndex() == aFltPos.m_nNode.GetIndex() &&
+            pLast->m_aPtPos.m_nContent == aFltPos.m_nContent)
+        {
+            //potential candidate for merging with an identical
+            //property beginning at rPos
+            pRet = pLast;
+        }
+
+        OpenEntries::iterator aStt, aEnd;
+        if (!nAttrId)
+        {
+            aStt = maOpenEntries.begin();
+            aEnd = maOpenEntries.end();
+        }
+        else
+        {
+            const long nKeyHand =
+                (nAttrId == RES_FLTR_BOOKMARK || nAttrId == RES_FLTR_ANNOTATIONMARK)
+                    ? nHand : 0;
+            std::pair<OpenEntries::iterator, OpenEntries::iterator> aRange =
+                maOpenEntries.equal_range(OpenKey(nAttrId, nKeyHand));
+            aStt = aRange.first;
+            aEnd = aRange.second;
+        }
+
+        while (aStt != aEnd)
+        {
+            SwFltStackEntry& rEntry = *aStt->second;
+            maOpenEntries.erase(aStt++);
+            CloseEntry(rEntry, rPos, consumedByField);
+            if (&rEntry == pLast && nAttrId == rEntry.pAttr->Which())
+            {
+                //potential candidate for merging with an identical
+                //property beginning at rPos
+                pRet = &rEntry;
+            }
+        }
+        return pRet;
+    }
+
     myEIter aI = maEntries.begin();
     while (aI != maEntries.end())
     {
@@ -363,9 +514,8 @@ SwFltStackEntry* SwFltControlStack::SetAttr(const SwPosition& rPos,
             }
             if (bF)
             {
-                rEntry.bConsumedByField = consumedByField;
-                rEntry.SetEndPos(rPos);
-                rEntry.SetEndCP(GetCurrAttrCP());
+                EraseOpenEntry(rEntry);
+                CloseEntry(rEntry, rPos, consumedByField);
                 if (bLastEntry && nAttrId == rEntry.pAttr->Which())
                 {
                     //potential candidate for merging with an identical
@@ -406,9 +556,13 @@ SwFltStackEntry* SwFltControlStack::SetAttr(const SwPosition& rPos,
             }
         }
         SetAttrInDoc(rPos, rEntry);
-        aI = maEntries.erase(aI);
+        aI = EraseEntry(aI);
     }
 
+    // the entries which are left closed all end in the node of rPos now
+    maClosedNode = aFltPos.m_nNode;
+    mbClosedInOneNode = true;
+
     return pRet;
 }
 
@@ -711,6 +865,9 @@ bool SwFltControlStack::CheckSdOD(sal_Int32 /*nStart*/, sal_Int32 /*nEnd*/)
 
 SfxPoolItem* SwFltControlStack::GetFormatStackAttr(sal_uInt16 nWhich, sal_uInt16 * pPos)
 {
+    if (!HasOpenEntry(nWhich))
+        return 0;
+
     size_t nSize = maEntries.size();
 
     while (nSize)
@@ -730,6 +887,9 @@ SfxPoolItem* SwFltControlStack::GetFormatStackAttr(sal_uInt16 nWhich, sal_uInt16
 
 const SfxPoolItem* SwFltControlStack::GetOpenStackAttr(const SwPosition& rPos, sal_uInt16 nWhich)
 {
+    if (!HasOpenEntry(nWhich))
+        return 0;
+
     SwFltPosition aFltPos(rPos);
 
     size_t nSize = maEntries.size();
@@ -823,6 +983,9 @@ void SwFltControlStack::Delete(const SwPaM &rPam)
                 rEntry.m_aPtPos.SetPos(aStartNode, nStartIdx);
             else
                 rEntry.m_aPtPos.m_nContent -= nContentDiff;
+            // the end of a closed entry may be in another node now
+            if (!rEntry.bOpen)
+                mbClosedInOneNode = false;
         }
 
         //That's what Open is, end equal to start, and nPtContent is invalid
@@ -35,6 +35,8 @@
 #include <boost/noncopyable.hpp>
 #include <boost/ptr_container/ptr_deque.hpp>
 
+#include <map>
+
 class SwTOXBase;
 class SwField;
 class SwFieldType;
@@ -137,6 +139,19 @@ class SW_DLLPUBLIC SwFltControlStack : private ::boost::noncopyable
     typedef Entries::iterator myEIter;
     Entries maEntries;
 
+    // The open entries by Which() and handle (bookmarks and annotation
+    // marks; 0 for all other attributes), so that closing an attribute
+    // does not need to look at every entry on the stack.
+    typedef std::pair<sal_uInt16, long> OpenKey;
+    typedef std::multimap<OpenKey, SwFltStackEntry*> OpenEntries;
+    OpenEntries maOpenEntries;
+    // number of entries on the stack, open or not, by Which()
+    std::map<sal_uInt16, size_t> maWhichCounts;
+    // if mbClosedInOneNode, all entries which are not open any more end
+    // in maClosedNode
+    SwNodeIndex maClosedNode;
+    bool mbClosedInOneNode;
+
     sal_uLong nFieldFlags;
     vcl::KeyCode aEmptyKeyCode; // fuer Bookmarks
 
@@ -144,6 +159,13 @@ private:
     bool bHasSdOD;
     bool bSdODChecked;
 
+    void AddEntry(SwFltStackEntry* pEntry);
+    myEIter EraseEntry(myEIter aElement);
+    void EraseOpenEntry(SwFltStackEntry& rEntry);
+    void CloseEntry(SwFltStackEntry& rEntry, const SwPosition& rPos, bool consumedByField);
+    bool NeedsFlush(const SwFltPosition& rFltPos, bool bTstEnde) const;
+    bool HasOpenEntry(sal_uInt16 nWhich) const;
+
 protected:
     SwDoc* pDoc;
     bool bIsEndStack;
@@ -186,6 +208,9 @@ public:
     void KillUnlockedAttrs(const SwPosition& pPos);
     SfxPoolItem* GetFormatStackAttr(sal_uInt16 nWhich, sal_uInt16 * pPos = 0);
     const SfxPoolItem* GetOpenStackAttr(const SwPosition& rPos, sal_uInt16 nWhich);
+    /// Is there any entry, open or not, for nWhich on the stack?
+    bool HasStackAttr(sal_uInt16 nWhich) const
+        { return maWhichCounts.find(nWhich) != maWhichCounts.end(); }
     void Delete(const SwPaM &rPam);
 
     bool empty() const { return maEntries.empty(); }
@@ -26,6 +26,7 @@
 #include "swtable.hxx"
 #include "frmfmt.hxx"
 #include "pam.hxx"
+#include "ndarr.hxx"
 #include "ndtxt.hxx"
 #include "dbgoutsw.hxx"
 
@@ -661,6 +662,34 @@ void WW8TableInfo::processSwTable(const SwTable * pTable)
     SAL_INFO( "sw.ww8", "</processSwTable>" );
 }
 
+/**
+   Forget everything known about pTable and the tables nested in it.
+
+   Only call this once the table has been written completely: the node
+   infos of a table are chained by plain pointers, and the cell grid
+   refers to them as well.
+*/
+void WW8TableInfo::releaseSwTable(const SwTable * pTable)
+{
+    const SwTableNode * pTableNode = pTable->GetTableNode();
+    const SwNodes & rNodes = pTableNode->GetNodes();
+    const sal_uLong nEnd = pTableNode->EndOfSectionIndex();
+
+    for (sal_uLong n = pTableNode->GetIndex(); n <= nEnd; ++n)
+    {
+        const SwNode * pNode = rNodes[n];
+
+        if (pNode->IsTableNode())
+        {
+            const SwTable * pInnerTable = &pNode->GetTableNode()->GetTable();
+            mCellGridMap.erase(pInnerTable);
+            mFirstInTableMap.erase(pInnerTable);
+        }
+
+        mMap.erase(pNode);
+    }
+}
+
 WW8TableNodeInfo *
 WW8TableInfo::processTableLine(const SwTable * pTable,
                                const SwTableLine * pTableLine,
@@ -341,6 +341,7 @@ public:
     virtual ~WW8TableInfo();
 
     void processSwTable(const SwTable * pTable);
+    void releaseSwTable(const SwTable * pTable);
     WW8TableNodeInfo * processSwTableByLayout(const SwTable * pTable);
     WW8TableNodeInfo::Pointer_t getTableNodeInfo(const SwNode * pNode);
     const SwNode * getNextNode(const SwNode * pNode);
@@ -393,15 +393,20 @@ bool DocxExport::lcl_CopyStream( uno::Reference<io::XInputStream> xIn, uno::Refe
     if( !xIn.is() || !xOut.is() )
         return false;
 
-    const sal_Int32 nChunkSize = 4096;
+    // Embedded objects can be large, so avoid a UNO round-trip for every few
+    // bytes.
+    const sal_Int32 nChunkSize = 65536;
     uno::Sequence< sal_Int8 > aData(nChunkSize);
     sal_Int32 nTotalRead = 0;
     sal_Int32 nRead = 0;
     do
     {
         nRead = xIn->readBytes(aData, nChunkSize);
+        if (nRead < aData.getLength())
+            aData.realloc(nRead);
+        if (nRead)
+            xOut->writeBytes(aData);
         nTotalRead += nRead;
-        xOut->writeBytes(aData);
     } while (nRead == nChunkSize);
     return nTotalRead != 0;
 }
@@ -1181,23 +1186,7 @@ void DocxExport::WriteActiveX()
 
             try
             {
-                sal_Int32 nBufferSize = 512;
-                uno::Sequence< sal_Int8 > aDataBuffer(nBufferSize);
-                sal_Int32 nRead;
-                do
-                {
-                    nRead = activeXBin->readBytes( aDataBuffer, nBufferSize );
-                    if( nRead )
-                    {
-                        if( nRead < nBufferSize )
-                        {
-                            nBufferSize = nRead;
-                            aDataBuffer.realloc(nRead);
-                        }
-                        xOutStream->writeBytes( aDataBuffer );
-                    }
-                }
-                while( nRead );
+                lcl_CopyStream( activeXBin, xOutStream );
                 xOutStream->flush();
             }
             catch(const uno::Exception&)
@@ -1255,23 +1244,7 @@ void DocxExport::WriteEmbeddings()
                                     contentType);
             try
             {
-                sal_Int32 nBufferSize = 512;
-                uno::Sequence< sal_Int8 > aDataBuffer(nBufferSize);
-                sal_Int32 nRead;
-                do
-                {
-                    nRead = embeddingsStream->readBytes( aDataBuffer, nBufferSize );
-                    if( nRead )
-                    {
-                        if( nRead < nBufferSize )
-                        {
-                            nBufferSize = nRead;
-                            aDataBuffer.realloc(nRead);
-                        }
-                        xOutStream->writeBytes( aDataBuffer );
-                    }
-                }
-                while( nRead );
+                lcl_CopyStream( embeddingsStream, xOutStream );
                 xOutStream->flush();
             }
             catch(const uno::Exception&)
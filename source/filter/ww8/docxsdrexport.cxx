@@ -1069,23 +1069,7 @@ void DocxSdrExport::writeDiagramRels(uno::Reference<xml::dom::XDocument> xDom,
 
         try
         {
-            sal_Int32 nBufferSize = 512;
-            uno::Sequence< sal_Int8 > aDataBuffer(nBufferSize);
-            sal_Int32 nRead;
-            do
-            {
-                nRead = dataImagebin->readBytes(aDataBuffer, nBufferSize);
-                if (nRead)
-                {
-                    if (nRead < nBufferSize)
-                    {
-                        nBufferSize = nRead;
-                        aDataBuffer.realloc(nRead);
-                    }
-                    xBinOutStream->writeBytes(aDataBuffer);
-                }
-            }
-            while (nRead);
+            DocxExport::lcl_CopyStream(dataImagebin, xBinOutStream);
             xBinOutStream->flush();
         }
         catch (const uno::Exception& rException)
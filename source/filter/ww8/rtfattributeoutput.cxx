@@ -3492,30 +3492,36 @@ static bool StripMetafileHeader(const sal_uInt8*& rpGraphicAry, unsigned long& r
 
 OString RtfAttributeOutput::WriteHex(const sal_uInt8* pData, sal_uInt32 nSize, SvStream* pStream, sal_uInt32 nLimit)
 {
-    OStringBuffer aRet;
+    static const sal_Char aHexDigits[] = "0123456789abcdef";
+    const sal_Int32 nNewlineLen = RTL_CONSTASCII_LENGTH(SAL_NEWLINE_STRING);
 
+    OStringBuffer aRet;
+    if (!pStream)
+        aRet.ensureCapacity(nSize * 2 + (nLimit ? nSize / nLimit * nNewlineLen : 0));
+
+    // Encode into a fixed-size chunk, then hand that over in one go: pictures
+    // can be megabytes, so don't touch the stream or the buffer per byte.
+    sal_Char aChunk[8192];
+    const sal_Int32 nChunkMax = sizeof(aChunk) - 2 - nNewlineLen;
+    sal_Int32 nPos = 0;
     sal_uInt32 nBreak = 0;
     for (sal_uInt32 i = 0; i < nSize; i++)
     {
-        OString sNo = OString::number(pData[i], 16);
-        if (sNo.getLength() < 2)
+        aChunk[nPos++] = aHexDigits[pData[i] >> 4];
+        aChunk[nPos++] = aHexDigits[pData[i] & 0xf];
+        if (++nBreak == nLimit)
         {
-            if (pStream)
-                pStream->WriteChar('0');
-            else
-                aRet.append('0');
+            for (sal_Int32 j = 0; j < nNewlineLen; ++j)
+                aChunk[nPos++] = SAL_NEWLINE_STRING[j];
+            nBreak = 0;
         }
-        if (pStream)
-            pStream->WriteCharPtr(sNo.getStr());
-        else
-            aRet.append(sNo);
-        if (++nBreak == nLimit)
+        if (nPos > nChunkMax || i == nSize - 1)
         {
             if (pStream)
-                pStream->WriteCharPtr(SAL_NEWLINE_STRING);
+                pStream->Write(aChunk, nPos);
             else
-                aRet.append(SAL_NEWLINE_STRING);
-            nBreak = 0;
+                aRet.append(aChunk, nPos);
+            nPos = 0;
         }
     }
 
@@ -2646,6 +2646,14 @@ void MSWordExportBase::WriteText()
             pNextNode = NULL;
         }
 
+        // A finished top-level table is not looked at again, so drop its
+        // node infos: otherwise they pile up for every table of the document.
+        if ( rNd.IsEndNode() && rNd.StartOfSectionNode()->IsTableNode() &&
+             !rNd.StartOfSectionNode()->StartOfSectionNode()->FindTableNode() )
+        {
+            m_pTableInfo->releaseSwTable( &rNd.StartOfSectionNode()->GetTableNode()->GetTable() );
+        }
+
         if (pNextNode != NULL)
             m_pCurPam->GetPoint()->nNode = SwNodeIndex(*pNextNode);
         else
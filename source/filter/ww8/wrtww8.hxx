@@ -1490,7 +1490,7 @@ private:
 
     const SwRangeRedline* pCurRedline;
     sal_Int32 nAktSwPos;
-    sal_uInt16 nCurRedlinePos;
+    size_t nCurRedlinePos;
 
     bool mbParaIsRTL;
 
@@ -1565,6 +1565,9 @@ const SfxPoolItem* SwWW8FltControlStack::GetFormatAttr(const SwPosition& rPos,
 const SfxPoolItem* SwWW8FltControlStack::GetStackAttr(const SwPosition& rPos,
     sal_uInt16 nWhich)
 {
+    if (!HasStackAttr(nWhich))
+        return 0;
+
     SwFltPosition aFltPos(rPos);
 
     size_t nSize = size();
@@ -3037,18 +3040,22 @@ bool SwWW8ImplReader::ReadPlainChars(WW8_CP& rPos, sal_Int32 nEnd, sal_Int32 nCp
     sal_Unicode* pBuffer = pStr->buffer;
     sal_Unicode* pWork = pBuffer;
 
-    sal_Char* p8Bits = NULL;
-
     rtl_TextToUnicodeConverter hConverter = 0;
     if (!m_bIsUnicode || m_bVer67)
         hConverter = rtl_createTextToUnicodeConverter(eSrcCharSet);
 
-    if (!m_bIsUnicode)
-        p8Bits = new sal_Char[nStrLen];
-
-    // read the stream data
-    sal_uInt8   nBCode = 0;
-    sal_uInt16 nUCode;
+    // Read the piece in chunks instead of character by character, and scan
+    // them in memory. Most calls stop at a special character long before
+    // nEnd, so reading up to nEnd each time would be quadratic in pieces
+    // with many of them. Afterwards the stream is positioned behind the
+    // characters taken, as before.
+    const sal_Int32 nChunkLen = 4096;
+    const sal_Size nCharSize = m_bIsUnicode ? 2 : 1;
+    const sal_Size nStartPos = m_pStrm->Tell();
+    std::vector<sal_uInt8> aChunk(std::min(nStrLen, nChunkLen) * nCharSize);
+    const sal_uInt8* pBytes = &aChunk[0];
+    sal_Int32 nChunkStart = 0, nChunkRead = 0;
+    std::vector<sal_Char> a8Bits; // the 8 bit characters taken, converted at the end
 
     sal_uInt16 nCTLLang = 0;
     const SfxPoolItem * pItem = GetFormatAttr(RES_CHRATR_CTL_LANGUAGE);
@@ -3058,27 +3065,34 @@ bool SwWW8ImplReader::ReadPlainChars(WW8_CP& rPos, sal_Int32 nEnd, sal_Int32 nCp
     sal_Int32 nL2;
     for( nL2 = 0; nL2 < nStrLen; ++nL2, ++pWork )
     {
-        if (m_bIsUnicode)
-            m_pStrm->ReadUInt16( nUCode ); // unicode  --> read 2 bytes
-        else
+        if (nL2 == nChunkStart + nChunkRead)
         {
-            m_pStrm->ReadUChar( nBCode ); // old code --> read 1 byte
-            nUCode = nBCode;
+            if (!m_bIsUnicode)
+                a8Bits.insert(a8Bits.end(), aChunk.begin(), aChunk.begin() + nChunkRead);
+            nChunkStart = nL2;
+            nChunkRead = static_cast<sal_Int32>(m_pStrm->Read(&aChunk[0],
+                std::min(nStrLen - nL2, nChunkLen) * nCharSize) / nCharSize);
+            if (!nChunkRead)
+            {
+                rPos = WW8_CP_MAX-10; // -> eof or other error
+                rtl_freeMemory(pStr);
+                if (hConverter)
+                    rtl_destroyTextToUnicodeConverter(hConverter);
+                return true;
+            }
         }
 
-        if (m_pStrm->GetError())
+        sal_uInt16 nUCode;
+        if (m_bIsUnicode)
         {
-            rPos = WW8_CP_MAX-10; // -> eof or other error
-            rtl_freeMemory(pStr);
-            delete [] p8Bits;
-            return true;
+            // unicode  --> 2 bytes, little endian
+            nUCode = SVBT16ToShort(pBytes + 2 * (nL2 - nChunkStart));
         }
+        else
+            nUCode = pBytes[nL2 - nChunkStart]; // old code --> 1 byte
 
         if ((32 > nUCode) || (0xa0 == nUCode))
-        {
-            m_pStrm->SeekRel( m_bIsUnicode ? -2 : -1 );
             break; // Special character < 32, == 0xa0 found
-        }
 
         if (m_bIsUnicode)
         {
@@ -3102,19 +3116,22 @@ bool SwWW8ImplReader::ReadPlainChars(WW8_CP& rPos, sal_Int32 nEnd, sal_Int32 nCp
                 }
             }
         }
-        else
-            p8Bits[nL2] = nBCode;
     }
+    m_pStrm->Seek(nStartPos + nL2 * nCharSize);
+    if (!m_bIsUnicode)
+        a8Bits.insert(a8Bits.end(), aChunk.begin(), aChunk.begin() + (nL2 - nChunkStart));
 
     if (nL2)
     {
         const sal_Int32 nEndUsed = !m_bIsUnicode
-            ? Custom8BitToUnicode(hConverter, p8Bits, nL2, pBuffer, nStrLen)
+            ? Custom8BitToUnicode(hConverter, &a8Bits[0], nL2, pBuffer, nStrLen)
             : nL2;
 
-        for( sal_Int32 nI = 0; nI < nStrLen; ++nI, ++pBuffer )
-            if (m_bRegardHindiDigits && m_bBidi && LangUsesHindiNumbers(nCTLLang))
+        if (m_bRegardHindiDigits && m_bBidi && LangUsesHindiNumbers(nCTLLang))
+        {
+            for( sal_Int32 nI = 0; nI < nEndUsed; ++nI, ++pBuffer )
                 *pBuffer = TranslateToHindiNumbers(*pBuffer);
+        }
 
         pStr->buffer[nEndUsed] = 0;
         pStr->length = nEndUsed;
@@ -3130,7 +3147,6 @@ bool SwWW8ImplReader::ReadPlainChars(WW8_CP& rPos, sal_Int32 nEnd, sal_Int32 nCp
         rtl_destroyTextToUnicodeConverter(hConverter);
     if (pStr)
         rtl_uString_release(pStr);
-    delete [] p8Bits;
     return nL2 >= nStrLen;
 }
 
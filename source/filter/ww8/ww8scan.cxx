@@ -2817,17 +2817,6 @@ void WW8PLCFx::SetIdx2(sal_uLong )
 {
 }
 
-class SamePos :
-    public std::unary_function<const WW8PLCFx_Fc_FKP::WW8Fkp *, bool>
-{
-private:
-    long mnPo;
-public:
-    explicit SamePos(long nPo) : mnPo(nPo) {}
-    bool operator()(const WW8PLCFx_Fc_FKP::WW8Fkp *pFkp)
-        {return mnPo == pFkp->GetFilePos();}
-};
-
 bool WW8PLCFx_Fc_FKP::NewFkp()
 {
     WW8_CP nPLCFStart, nPLCFEnd;
@@ -2880,21 +2869,29 @@ bool WW8PLCFx_Fc_FKP::NewFkp()
         pFkp->Reset(GetStartFc());
     else
     {
-        myiter aIter =
-            std::find_if(maFkpCache.begin(), maFkpCache.end(), SamePos(nPo));
-        if (aIter != maFkpCache.end())
+        std::unordered_map<long, myiter>::iterator aPos = maFkpCachePos.find(nPo);
+        if (aPos != maFkpCachePos.end())
         {
-            pFkp = *aIter;
+            // most recently used goes to the end
+            maFkpCache.splice(maFkpCache.end(), maFkpCache, aPos->second);
+            pFkp = *aPos->second;
             pFkp->Reset(GetStartFc());
+#if OSL_DEBUG_LEVEL > 0
+            ++mnCacheHits;
+#endif
         }
         else
         {
             pFkp = new WW8Fkp(GetFIBVersion(), pFKPStrm, pDataStrm, nPo,
                 pFkpSizeTab[ ePLCF ], ePLCF, GetStartFc());
-            maFkpCache.push_back(pFkp);
+            maFkpCachePos[nPo] = maFkpCache.insert(maFkpCache.end(), pFkp);
+#if OSL_DEBUG_LEVEL > 0
+            ++mnCacheMisses;
+#endif
 
             if (maFkpCache.size() > eMaxCache)
             {
+                maFkpCachePos.erase(maFkpCache.front()->GetFilePos());
                 delete maFkpCache.front();
                 maFkpCache.pop_front();
             }
@@ -2908,7 +2905,11 @@ bool WW8PLCFx_Fc_FKP::NewFkp()
 WW8PLCFx_Fc_FKP::WW8PLCFx_Fc_FKP(SvStream* pSt, SvStream* pTableSt,
     SvStream* pDataSt, const WW8Fib& rFib, ePLCFT ePl, WW8_FC nStartFcL)
     : WW8PLCFx(rFib.GetFIBVersion(), true), pFKPStrm(pSt), pDataStrm(pDataSt),
-    pFkp(0), ePLCF(ePl), pPCDAttrs(0)
+    pFkp(0),
+#if OSL_DEBUG_LEVEL > 0
+    mnCacheHits(0), mnCacheMisses(0),
+#endif
+    ePLCF(ePl), pPCDAttrs(0)
 {
     SetStartFc(nStartFcL);
     long nLenStruct = (8 > rFib.nVersion) ? 2 : 4;
@@ -2926,6 +2927,10 @@ WW8PLCFx_Fc_FKP::WW8PLCFx_Fc_FKP(SvStream* pSt, SvStream* pTableSt,
 
 WW8PLCFx_Fc_FKP::~WW8PLCFx_Fc_FKP()
 {
+#if OSL_DEBUG_LEVEL > 0
+    SAL_INFO("sw.ww8", "FKP cache of " << (ePLCF == CHP ? "CHPX" : "PAPX") << ": "
+        << mnCacheHits << " hits, " << mnCacheMisses << " misses");
+#endif
     myiter aEnd = maFkpCache.end();
     for (myiter aIter = maFkpCache.begin(); aIter != aEnd; ++aIter)
         delete *aIter;
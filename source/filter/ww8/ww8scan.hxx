@@ -566,10 +566,21 @@ private:
         == 50     : 18918 pap, 48 chp
         == 10     : 18549 pap, 47 chp
         == 5      : 18515 pap, 47 chp
+
+        The cache is kept in least recently used order and looked up by the
+        file position of the page, so a bigger cache costs nothing on lookup:
+        fast saved documents with long piece tables jump back and forth
+        between the pages all the time. eMaxCache bounds the memory use.
     */
-    typedef std::list<WW8Fkp*>::iterator myiter;
-    std::list<WW8Fkp*> maFkpCache;
-    enum Limits {eMaxCache = 5};
+    typedef std::list<WW8Fkp*> FkpCache;
+    typedef FkpCache::iterator myiter;
+    FkpCache maFkpCache;
+    std::unordered_map<long, myiter> maFkpCachePos;
+    enum Limits {eMaxCache = 100};
+#if OSL_DEBUG_LEVEL > 0
+    sal_uLong mnCacheHits;
+    sal_uLong mnCacheMisses;
+#endif
 
     bool NewFkp();
 
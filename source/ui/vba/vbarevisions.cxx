@@ -18,9 +18,14 @@
  */
 #include "vbarevisions.hxx"
 #include "vbarevision.hxx"
+#include "wordvbahelper.hxx"
 #include <cppuhelper/implbase.hxx>
 #include <com/sun/star/document/XRedlinesSupplier.hpp>
 #include <com/sun/star/text/XTextRangeCompare.hpp>
+#include <docsh.hxx>
+#include <doc.hxx>
+#include <docary.hxx>
+#include <IDocumentRedlineAccess.hxx>
 
 using namespace ::ooo::vba;
 using namespace ::com::sun::star;
@@ -132,8 +137,25 @@ SwVbaRevisions::createCollectionObject( const css::uno::Any& aSource )
     return uno::makeAny( uno::Reference< word::XRevision > ( new SwVbaRevision( this, mxContext, mxModel, xRevision ) ) );
 }
 
+bool SwVbaRevisions::AcceptRejectAll( bool bAccept )
+{
+    // If the collection covers every redline of the document, let the core
+    // handle all of them in one pass instead of one by one.
+    SwDoc* pDoc = word::getDocShell( mxModel )->GetDoc();
+    if( !pDoc )
+        return false;
+    IDocumentRedlineAccess& rIDRA = pDoc->getIDocumentRedlineAccess();
+    if( static_cast< SwRedlineTable::size_type >( m_xIndexAccess->getCount() ) != rIDRA.GetRedlineTable().size() )
+        return false;
+    rIDRA.AcceptAllRedline( bAccept );
+    return true;
+}
+
 void SAL_CALL SwVbaRevisions::AcceptAll(  ) throw (css::uno::RuntimeException, std::exception)
 {
+    if( AcceptRejectAll( true ) )
+        return;
+
     // First we need to put all the redline into a vector, because if the redline is accepted,
     // it will auto delete in the document.
     std::vector< uno::Reference< word::XRevision > > aRevisions;
@@ -154,7 +176,8 @@ void SAL_CALL SwVbaRevisions::AcceptAll(  ) throw (css::uno::RuntimeException, s
 
 void SAL_CALL SwVbaRevisions::RejectAll(  ) throw (css::uno::RuntimeException, std::exception)
 {
-    throw uno::RuntimeException();
+    if( !AcceptRejectAll( false ) )
+        throw uno::RuntimeException();
 }
 
 OUString
@@ -31,6 +31,9 @@ class SwVbaRevisions : public SwVbaRevisions_BASE
 private:
     css::uno::Reference< css::frame::XModel > mxModel;
 
+    /// Accept or reject all redlines of the document at once, if this collection covers all of them.
+    bool AcceptRejectAll( bool bAccept );
+
 public:
     SwVbaRevisions( const css::uno::Reference< ov::XHelperInterface >& xParent, const css::uno::Reference< css::uno::XComponentContext > & xContext, const css::uno::Reference< css::frame::XModel >& xModel, const css::uno::Reference< css::text::XTextRange >& xTextRange );
 
@@ -6198,6 +6198,8 @@ Selection SwEditWin::GetSurroundingTextSelection() const
 
 void SwEditWin::LogicInvalidate(const Rectangle* pRectangle)
 {
+    m_rView.GetWrtShell().InvalidateTileCache(pRectangle);
+
     OString sRectangle;
     if (!pRectangle)
         sRectangle = "EMPTY";
@@ -21,6 +21,7 @@
 #include "swdllapi.h"
 #include "chldwrap.hxx"
 #include <redline.hxx>
+#include <docary.hxx>
 #include <tools/datetime.hxx>
 #include <vcl/msgbox.hxx>
 #include <svl/eitem.hxx>
@@ -104,16 +105,16 @@ class SW_DLLPUBLIC SwRedlineAcceptDlg
     DECL_DLLPRIVATE_LINK_TYPED( GotoHdl, Timer*, void );
     DECL_DLLPRIVATE_LINK( CommandHdl,        void* );
 
-    SAL_DLLPRIVATE sal_uInt16            CalcDiff(sal_uInt16 nStart, bool bChild);
+    SAL_DLLPRIVATE SwRedlineTable::size_type CalcDiff(SwRedlineTable::size_type nStart, bool bChild);
     SAL_DLLPRIVATE void          InsertChildren(SwRedlineDataParent *pParent, const SwRangeRedline& rRedln, const sal_uInt16 nAutoFormat);
-    SAL_DLLPRIVATE void          InsertParents(sal_uInt16 nStart, sal_uInt16 nEnd = USHRT_MAX);
-    SAL_DLLPRIVATE void          RemoveParents(sal_uInt16 nStart, sal_uInt16 nEnd);
+    SAL_DLLPRIVATE void          InsertParents(SwRedlineTable::size_type nStart, SwRedlineTable::size_type nEnd = SwRedlineTable::npos);
+    SAL_DLLPRIVATE void          RemoveParents(SwRedlineTable::size_type nStart, SwRedlineTable::size_type nEnd);
     SAL_DLLPRIVATE void          InitAuthors();
 
     SAL_DLLPRIVATE OUString      GetRedlineText(const SwRangeRedline& rRedln, DateTime &rDateTime, sal_uInt16 nStack = 0);
     SAL_DLLPRIVATE Image         GetActionImage(const SwRangeRedline& rRedln, sal_uInt16 nStack = 0);
     SAL_DLLPRIVATE OUString      GetActionText(const SwRangeRedline& rRedln, sal_uInt16 nStack = 0);
-    SAL_DLLPRIVATE sal_uInt16    GetRedlinePos( const SvTreeListEntry& rEntry) const;
+    SAL_DLLPRIVATE SwRedlineTable::size_type GetRedlinePos( const SvTreeListEntry& rEntry) const;
 
 public:
     SwRedlineAcceptDlg(vcl::Window *pParent, VclBuilderContainer *pBuilder, vcl::Window *pContentArea, bool bAutoFormat = false);
@@ -124,7 +125,7 @@ public:
     inline SvxAcceptChgCtr& GetChgCtrl()        { return *aTabPagesCTRL.get(); }
     inline bool     HasRedlineAutoFormat() const   { return bRedlnAutoFormat; }
 
-    void            Init(sal_uInt16 nStart = 0);
+    void            Init(SwRedlineTable::size_type nStart = 0);
     void            CallAcceptReject( bool bSelect, bool bAccept );
 
     void            Initialize(const OUString &rExtraData);
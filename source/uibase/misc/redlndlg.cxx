@@ -224,7 +224,7 @@ SwRedlineAcceptDlg::~SwRedlineAcceptDlg()
     aTabPagesCTRL.disposeAndClear();
 }
 
-void SwRedlineAcceptDlg::Init(sal_uInt16 nStart)
+void SwRedlineAcceptDlg::Init(SwRedlineTable::size_type nStart)
 {
     SwWait aWait( *::GetActiveView()->GetDocShell(), false );
     pTable->SetUpdateMode(false);
@@ -263,15 +263,14 @@ void SwRedlineAcceptDlg::InitAuthors()
     OUString sOldAuthor(pFilterPage->GetSelectedAuthor());
     pFilterPage->ClearAuthors();
 
-    sal_uInt16 nCount = pSh->GetRedlineCount();
+    SwRedlineTable::size_type nCount = pSh->GetRedlineCount();
 
     bOnlyFormatedRedlines = true;
     bHasReadonlySel = false;
     bool bIsNotFormated = false;
-    sal_uInt16 i;
 
     // determine authors
-    for ( i = 0; i < nCount; i++)
+    for ( SwRedlineTable::size_type i = 0; i < nCount; i++)
     {
         const SwRangeRedline& rRedln = pSh->GetRedline(i);
 
@@ -289,7 +288,7 @@ void SwRedlineAcceptDlg::InitAuthors()
     std::sort(aStrings.begin(), aStrings.end());
     aStrings.erase(std::unique(aStrings.begin(), aStrings.end()), aStrings.end());
 
-    for (i = 0; i < aStrings.size(); i++)
+    for (size_t i = 0; i < aStrings.size(); i++)
         pFilterPage->InsertAuthor(aStrings[i]);
 
     if (pFilterPage->SelectAuthor(sOldAuthor) == LISTBOX_ENTRY_NOTFOUND && !aStrings.empty())
@@ -303,8 +302,8 @@ void SwRedlineAcceptDlg::InitAuthors()
     {
         // find the selected redline
         // (fdo#57874: ignore, if the redline is already gone)
-        sal_uInt16 nPos = GetRedlinePos(*pSelEntry);
-        if( nPos != USHRT_MAX )
+        SwRedlineTable::size_type nPos = GetRedlinePos(*pSelEntry);
+        if( nPos != SwRedlineTable::npos )
         {
             const SwRangeRedline& rRedln = pSh->GetRedline( nPos );
 
@@ -397,11 +396,11 @@ void SwRedlineAcceptDlg::Activate()
 
     // did something change?
     SwWrtShell* pSh = pView->GetWrtShellPtr();
-    sal_uInt16 nCount = pSh->GetRedlineCount();
+    SwRedlineTable::size_type nCount = pSh->GetRedlineCount();
 
     // check the number of pointers
     SwRedlineDataParent *pParent = 0;
-    sal_uInt16 i;
+    SwRedlineTable::size_type i;
 
     for ( i = 0; i < nCount; i++)
     {
@@ -418,7 +417,7 @@ void SwRedlineAcceptDlg::Activate()
         if (&rRedln.GetRedlineData() != pParent->pData)
         {
             // Redline-Parents were inserted, changed or deleted
-            if ((i = CalcDiff(i, false)) == USHRT_MAX)
+            if ((i = CalcDiff(i, false)) == SwRedlineTable::npos)
                 return;
             continue;
         }
@@ -429,7 +428,7 @@ void SwRedlineAcceptDlg::Activate()
         if (!pRedlineData && pBackupData)
         {
             // Redline-Children were deleted
-            if ((i = CalcDiff(i, true)) == USHRT_MAX)
+            if ((i = CalcDiff(i, true)) == SwRedlineTable::npos)
                 return;
             continue;
         }
@@ -440,7 +439,7 @@ void SwRedlineAcceptDlg::Activate()
                 if (pRedlineData != pBackupData->pChild)
                 {
                     // Redline-Children were inserted, changed or deleted
-                    if ((i = CalcDiff(i, true)) == USHRT_MAX)
+                    if ((i = CalcDiff(i, true)) == SwRedlineTable::npos)
                         return;
                     continue;
                 }
@@ -478,12 +477,12 @@ void SwRedlineAcceptDlg::Activate()
     InitAuthors();
 }
 
-sal_uInt16 SwRedlineAcceptDlg::CalcDiff(sal_uInt16 nStart, bool bChild)
+SwRedlineTable::size_type SwRedlineAcceptDlg::CalcDiff(SwRedlineTable::size_type nStart, bool bChild)
 {
     if (!nStart)
     {
         Init();
-        return USHRT_MAX;
+        return SwRedlineTable::npos;
     }
 
     pTable->SetUpdateMode(false);
@@ -525,7 +524,7 @@ sal_uInt16 SwRedlineAcceptDlg::CalcDiff(sal_uInt16 nStart, bool bChild)
 
     // have entries been deleted?
     const SwRedlineData *pRedlineData = &rRedln.GetRedlineData();
-    sal_uInt16 i;
+    SwRedlineTable::size_type i;
     for ( i = nStart + 1; i < aRedlineParents.size(); i++)
     {
         if (aRedlineParents[i].pData == pRedlineData)
@@ -538,7 +537,7 @@ sal_uInt16 SwRedlineAcceptDlg::CalcDiff(sal_uInt16 nStart, bool bChild)
     }
 
     // entries been inserted?
-    sal_uInt16 nCount = pSh->GetRedlineCount();
+    SwRedlineTable::size_type nCount = pSh->GetRedlineCount();
     pRedlineData = aRedlineParents[nStart].pData;
 
     for (i = nStart + 1; i < nCount; i++)
@@ -554,7 +553,7 @@ sal_uInt16 SwRedlineAcceptDlg::CalcDiff(sal_uInt16 nStart, bool bChild)
 
     pTable->SetUpdateMode(true);
     Init(nStart);   // adjust all entries until the end
-    return USHRT_MAX;
+    return SwRedlineTable::npos;
 }
 
 void SwRedlineAcceptDlg::InsertChildren(SwRedlineDataParent *pParent, const SwRangeRedline& rRedln, const sal_uInt16 nAutoFormat)
@@ -642,10 +641,10 @@ void SwRedlineAcceptDlg::InsertChildren(SwRedlineDataParent *pParent, const SwRa
     }
 }
 
-void SwRedlineAcceptDlg::RemoveParents(sal_uInt16 nStart, sal_uInt16 nEnd)
+void SwRedlineAcceptDlg::RemoveParents(SwRedlineTable::size_type nStart, SwRedlineTable::size_type nEnd)
 {
     SwWrtShell* pSh = ::GetActiveView()->GetWrtShellPtr();
-    sal_uInt16 nCount = pSh->GetRedlineCount();
+    SwRedlineTable::size_type nCount = pSh->GetRedlineCount();
 
     SvLBoxEntryArr aLBoxArr;
 
@@ -657,7 +656,7 @@ void SwRedlineAcceptDlg::RemoveParents(sal_uInt16 nStart, sal_uInt16 nEnd)
 
     // set the cursor after the last entry because otherwise performance problem in TLB.
     // TLB would otherwise reset the cursor at every Remove (expensive)
-    sal_uInt16 nPos = std::min((sal_uInt16)nCount, (sal_uInt16)aRedlineParents.size());
+    SwRedlineTable::size_type nPos = std::min(nCount, aRedlineParents.size());
     SvTreeListEntry *pCurEntry = NULL;
     while( ( pCurEntry == NULL ) && ( nPos > 0 ) )
     {
@@ -670,7 +669,7 @@ void SwRedlineAcceptDlg::RemoveParents(sal_uInt16 nStart, sal_uInt16 nEnd)
 
     SvTreeList* pModel = pTable->GetModel();
 
-    for (sal_uInt16 i = nStart; i <= nEnd; i++)
+    for (SwRedlineTable::size_type i = nStart; i <= nEnd; i++)
     {
         if (!bChildrenRemoved && aRedlineParents[i].pNext)
         {
@@ -716,17 +715,17 @@ void SwRedlineAcceptDlg::RemoveParents(sal_uInt16 nStart, sal_uInt16 nEnd)
     aRedlineParents.erase( aRedlineParents.begin() + nStart, aRedlineParents.begin() + nEnd + 1);
 }
 
-void SwRedlineAcceptDlg::InsertParents(sal_uInt16 nStart, sal_uInt16 nEnd)
+void SwRedlineAcceptDlg::InsertParents(SwRedlineTable::size_type nStart, SwRedlineTable::size_type nEnd)
 {
     SwView *pView   = ::GetActiveView();
     SwWrtShell* pSh = pView->GetWrtShellPtr();
     sal_uInt16 nAutoFormat = HasRedlineAutoFormat() ? nsRedlineType_t::REDLINE_FORM_AUTOFMT : 0;
 
     OUString sParent;
-    sal_uInt16 nCount = pSh->GetRedlineCount();
-    nEnd = std::min((sal_uInt16)nEnd, (sal_uInt16)(nCount - 1)); // also treats nEnd=USHRT_MAX (until the end)
+    SwRedlineTable::size_type nCount = pSh->GetRedlineCount();
+    nEnd = std::min(nEnd, (nCount - 1)); // also treats nEnd=SwRedlineTable::npos (until the end)
 
-    if (nEnd == USHRT_MAX)
+    if (nEnd == SwRedlineTable::npos)
         return;     // no redlines in the document
 
     SvTreeListEntry *pParent;
@@ -746,7 +745,7 @@ void SwRedlineAcceptDlg::InsertParents(sal_uInt16 nStart, sal_uInt16 nEnd)
     else
         pCurrRedline = 0;
 
-    for (sal_uInt16 i = nStart; i <= nEnd; i++)
+    for (SwRedlineTable::size_type i = nStart; i <= nEnd; i++)
     {
         const SwRangeRedline& rRedln = pSh->GetRedline(i);
         const SwRedlineData *pRedlineData = &rRedln.GetRedlineData();
@@ -808,15 +807,19 @@ void SwRedlineAcceptDlg::CallAcceptReject( bool bSelect, bool bAccept )
         pEntry = bSelect ? pTable->NextSelected(pEntry) : pTable->Next(pEntry);
     }
 
-    bool (SwEditShell:: *FnAccRej)( sal_uInt16 ) = &SwEditShell::AcceptRedline;
+    bool (SwEditShell:: *FnAccRej)( SwRedlineTable::size_type ) = &SwEditShell::AcceptRedline;
     if( !bAccept )
         FnAccRej = &SwEditShell::RejectRedline;
 
     SwWait aWait( *pSh->GetView().GetDocShell(), true );
     pSh->StartAction();
 
+    // every change of the document is listed and enabled: let the core
+    // accept/reject all of them in one pass with a single undo action
+    const bool bAll = !bSelect && aRedlines.size() == pSh->GetRedlineCount();
+
     // #111827#
-    if (aRedlines.size() > 1)
+    if (!bAll && aRedlines.size() > 1)
     {
         OUString aTmpStr;
         {
@@ -838,18 +841,23 @@ void SwRedlineAcceptDlg::CallAcceptReject( bool bSelect, bool bAccept )
     // are merged in result of another one being deleted), so the
     // position must be resolved late and checked before using it.
     // (cf #102547#)
-    ListBoxEntries_t::iterator aEnd = aRedlines.end();
-    for( ListBoxEntries_t::iterator aIter = aRedlines.begin();
-         aIter != aEnd;
-         ++aIter )
+    if( bAll )
+        pSh->AcceptAllRedline( bAccept );
+    else
     {
-        sal_uInt16 nPosition = GetRedlinePos( **aIter );
-        if( nPosition != USHRT_MAX )
-            (pSh->*FnAccRej)( nPosition );
+        ListBoxEntries_t::iterator aEnd = aRedlines.end();
+        for( ListBoxEntries_t::iterator aIter = aRedlines.begin();
+             aIter != aEnd;
+             ++aIter )
+        {
+            SwRedlineTable::size_type nPosition = GetRedlinePos( **aIter );
+            if( nPosition != SwRedlineTable::npos )
+                (pSh->*FnAccRej)( nPosition );
+        }
     }
 
     // #111827#
-    if (aRedlines.size() > 1)
+    if (!bAll && aRedlines.size() > 1)
     {
         pSh->EndUndo();
     }
@@ -876,7 +884,7 @@ void SwRedlineAcceptDlg::CallAcceptReject( bool bSelect, bool bAccept )
     pTPView->EnableUndo();
 }
 
-sal_uInt16 SwRedlineAcceptDlg::GetRedlinePos( const SvTreeListEntry& rEntry ) const
+SwRedlineTable::size_type SwRedlineAcceptDlg::GetRedlinePos( const SvTreeListEntry& rEntry ) const
 {
     SwWrtShell* pSh = ::GetActiveView()->GetWrtShellPtr();
     return pSh->FindRedlineOfData( *static_cast<SwRedlineDataParent*>(static_cast<RedlinData *>(
@@ -993,8 +1001,8 @@ IMPL_LINK_NOARG_TYPED(SwRedlineAcceptDlg, GotoHdl, Timer *, void)
                 bSel = true;
 
             // #98864# find the selected redline (ignore, if the redline is already gone)
-            sal_uInt16 nPos = GetRedlinePos(*pActEntry);
-            if( nPos != USHRT_MAX )
+            SwRedlineTable::size_type nPos = GetRedlinePos(*pActEntry);
+            if( nPos != SwRedlineTable::npos )
             {
 
                 const SwRangeRedline& rRedln = pSh->GetRedline( nPos );
@@ -1039,10 +1047,10 @@ IMPL_LINK_NOARG(SwRedlineAcceptDlg, CommandHdl)
                 if (pTable->GetParent(pEntry))
                     pTopEntry = pTable->GetParent(pEntry);
 
-                sal_uInt16 nPos = GetRedlinePos(*pTopEntry);
+                SwRedlineTable::size_type nPos = GetRedlinePos(*pTopEntry);
 
                 // disable commenting for protected areas
-                if (nPos != USHRT_MAX && (pRed = pSh->GotoRedline(nPos, true)) != 0)
+                if (nPos != SwRedlineTable::npos && (pRed = pSh->GotoRedline(nPos, true)) != 0)
                 {
                     if( pSh->IsCrsrPtAtEnd() )
                         pSh->SwapPam();
@@ -1082,9 +1090,9 @@ IMPL_LINK_NOARG(SwRedlineAcceptDlg, CommandHdl)
                         if (pTable->GetParent(pEntry))
                             pEntry = pTable->GetParent(pEntry);
 
-                        sal_uInt16 nPos = GetRedlinePos(*pEntry);
+                        SwRedlineTable::size_type nPos = GetRedlinePos(*pEntry);
 
-                        if (nPos == USHRT_MAX)
+                        if (nPos == SwRedlineTable::npos)
                             break;
 
                         const SwRangeRedline &rRedline = pSh->GetRedline(nPos);
@@ -686,7 +686,7 @@ void SwView::Execute(SfxRequest &rReq)
                 // This ensures we work properly with FN_REDLINE_NEXT_CHANGE, which leaves the
                 // point at the *end* of the redline and the mark at the start (so GetRedline
                 // would return NULL if called on the point)
-                sal_uInt16 nRedline = 0;
+                SwRedlineTable::size_type nRedline = 0;
                 const SwRangeRedline *pRedline = pDoc->getIDocumentRedlineAccess().GetRedline(*pCursor->Start(), &nRedline);
                 assert(pRedline != 0);
                 if (pRedline)
@@ -701,6 +701,10 @@ void SwView::Execute(SfxRequest &rReq)
             GetViewFrame()->GetDispatcher()->Execute(FN_REDLINE_NEXT_CHANGE, SfxCallMode::ASYNCHRON);
         }
         break;
+        case FN_REDLINE_ACCEPT_ALL:
+        case FN_REDLINE_REJECT_ALL:
+            m_pWrtShell->AcceptAllRedline( FN_REDLINE_ACCEPT_ALL == nSlot );
+        break;
 
         case FN_REDLINE_NEXT_CHANGE:
         {
@@ -307,7 +307,7 @@ void SwView::GetState(SfxItemSet &rSet)
                     rSet.DisableItem(nWhich);
                 else if (pCursor->HasMark())
                 { // If the selection does not contain redlines, disable accepting/rejecting changes.
-                    sal_uInt16 index = 0;
+                    SwRedlineTable::size_type index = 0;
                     const SwRedlineTable& table = pDoc->getIDocumentRedlineAccess().GetRedlineTable();
                     const SwRangeRedline* redline = table.FindAtPosition( *pCursor->Start(), index );
                     if( redline != NULL && *redline->Start() == *pCursor->End())
@@ -339,6 +339,15 @@ void SwView::GetState(SfxItemSet &rSet)
             }
             break;
 
+            case FN_REDLINE_ACCEPT_ALL:
+            case FN_REDLINE_REJECT_ALL:
+            {
+                if (GetDocShell()->HasChangeRecordProtection() ||
+                    0 == m_pWrtShell->GetRedlineCount())
+                    rSet.DisableItem(nWhich);
+            }
+            break;
+
             case FN_REDLINE_NEXT_CHANGE:
             case FN_REDLINE_PREV_CHANGE:
             {
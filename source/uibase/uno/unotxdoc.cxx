@@ -3137,6 +3137,17 @@ void SwXTextDocument::paintTile( VirtualDevice &rDevice,
                           nTilePosX, nTilePosY, nTileWidth, nTileHeight);
 }
 
+void SwXTextDocument::paintTiles( const std::vector<VirtualDevice*>& rDevices,
+                                  const std::vector<Point>& rTilePositions,
+                                  int nOutputWidth, int nOutputHeight,
+                                  long nTileWidth, long nTileHeight )
+{
+    SwDoc* pDoc = pDocShell->GetDoc();
+    SwViewShell* pViewShell = pDoc->getIDocumentLayoutAccess().GetCurrentViewShell();
+    pViewShell->PaintTiles(rDevices, rTilePositions, nOutputWidth, nOutputHeight,
+                           nTileWidth, nTileHeight);
+}
+
 Size SwXTextDocument::getDocumentSize()
 {
     SwDoc* pDoc = pDocShell->GetDoc();